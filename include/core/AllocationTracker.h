@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+
+// ============================================================
+// AllocationTracker: Debug counter for global new/delete
+// ============================================================
+// Built with GOTD_TRACK_ALLOCATIONS (Debug configurations), the
+// global operator new/delete are replaced with versions that
+// count calls and bytes while counting is switched on for the
+// calling thread, attributed to the innermost AllocationScope.
+// Without the define, everything here compiles to no-ops and
+// IsEnabled() returns false.
+//
+//     AllocationTracker::Begin();
+//     { AllocationScope scope("TowerSystem"); towerSystem.Update(dt, enemies); }
+//     AllocationTracker::End();
+//
+// State is thread-local, so worker threads don't disturb a
+// measurement taken on another thread.
+// ============================================================
+
+struct AllocationStats {
+    const char* scope = nullptr;  // Label passed to AllocationScope ("(none)" outside any)
+    size_t allocations = 0;
+    size_t frees = 0;
+    size_t bytes = 0;
+};
+
+namespace AllocationTracker {
+    static constexpr int MAX_SCOPES = 16;
+
+    // True if the global new/delete hooks are compiled in
+    bool IsEnabled();
+
+    // Clear all counters and start / stop counting on this thread
+    void Begin();
+    void End();
+
+    // Totals over all scopes since Begin()
+    AllocationStats GetTotal();
+
+    // Per-scope counters; returns the number written to out
+    int GetScopes(AllocationStats* out, int maxCount);
+
+    // Used by AllocationScope; returns the previous scope
+    const char* EnterScope(const char* name);
+    void LeaveScope(const char* previous);
+}
+
+// Attribute allocations on this thread to `name` until destroyed.
+// `name` must be a string literal (stored by pointer).
+class AllocationScope {
+public:
+    explicit AllocationScope(const char* name) : previous(AllocationTracker::EnterScope(name)) {}
+    ~AllocationScope() { AllocationTracker::LeaveScope(previous); }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    const char* previous;
+};
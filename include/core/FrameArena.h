@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+// ============================================================
+// FrameArena: Bump allocator for data that lives for one tick
+// ============================================================
+// Allocation is a pointer bump inside one block; deallocation is
+// a no-op and everything is released at once by Reset() at the
+// end of the tick. If a tick outgrows the block, the extra
+// requests are served from overflow blocks on the heap and the
+// next Reset() replaces the block with one large enough for that
+// high-water mark, so the steady-state tick never touches the
+// global heap.
+//
+// Usable directly or as a std::pmr::memory_resource, e.g.
+//     std::pmr::vector<Hit> hits(&arena);
+// Not thread-safe: one arena per simulation.
+// ============================================================
+class FrameArena : public std::pmr::memory_resource {
+public:
+    explicit FrameArena(size_t initialCapacity = DEFAULT_CAPACITY);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Release everything allocated this tick (call once per tick)
+    void Reset();
+
+    // Stats
+    size_t GetCapacity() const { return capacity; }
+    size_t GetBytesUsed() const { return offset + overflowBytes; }
+    size_t GetPeakBytes() const { return peakBytes; }
+    int GetOverflowCount() const { return overflowCount; }  // Heap fallbacks since construction
+
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    struct Overflow {
+        void* ptr;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    std::byte* block;
+    size_t capacity;
+    size_t offset;
+    size_t peakBytes;
+    size_t overflowBytes;
+    int overflowCount;
+    std::vector<Overflow> overflows;
+};
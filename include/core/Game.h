@@ -1,9 +1,14 @@
 #pragma once
 #include "GameState.h"
+#include "FrameArena.h"
+#include "GameEvents.h"
+#include "MemoryReport.h"
 #include "systems/EnemySystem.h"
 #include "systems/WaveSystem.h"
 #include "systems/UISystem.h"
 #include "systems/TowerSystem.h"
+#include "systems/CameraSystem.h"
+#include "systems/ParticleSystem.h"
 #include "map/Map.h"
 #include "tower/TowerTypes.h"
 
@@ -20,20 +25,36 @@ public:
     void ResetGame();
 
 private:
+    void LoadMap();
     void SetupWaypoints();
     void ConnectSystems();
     void UpdateHUD();
     void HandleTowerPlacement();
     void DrawTowerUI();
+    void StartGame(bool endless);
+    void ReportEndlessRun() const;
+    void SampleMemory();
+    void DrawMemoryOverlay() const;
 
     GameState currentState;
     
+    // Entity storage shared by the systems below (declared first so it outlives them)
+    Registry registry;
+    
+    // Scratch memory for one simulation tick, reset at the end of Update()
+    FrameArena frameArena;
+    
+    // Typed event queues, dispatched at the end of Update()
+    EventBus events;
+    
     // Core game systems
     EnemySystem enemySystem;
     WaveSystem waveSystem;
     UISystem uiSystem;
     TowerSystem towerSystem;
     Map gameMap;
+    CameraSystem camera;    // World view (pan/zoom) for the map, enemies and towers
+    ParticleSystem particles;   // Hit, splash and death effects (fed by events, draw only)
     
     // Game state
     int playerHP;
@@ -42,4 +63,12 @@ private:
     // Tower placement state
     TowerType selectedTowerType;
     bool placingTower;
+    
+    // Endless/survival mode (formula waves, used as a soak test)
+    bool endlessMode;
+    double lastDrawSeconds;
+    
+    // Bytes per system, sampled every tick; logged at wave end, overlay on F3
+    MemoryReport memory;
+    bool showMemoryOverlay;
 };
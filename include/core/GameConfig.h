@@ -8,6 +8,7 @@ struct GameConfig {
 	int screenWidth = 1280;
 	int screenHeight = 720;
 	const char* windowTitle = "Guardians of the Deep";
+	const char* mapFile = nullptr;	// --map=DOSYA ile verilen harita (nullptr = varsayılan harita)
 };
 
 // UI ve metinler için kullanılacak ana font.
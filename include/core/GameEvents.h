@@ -0,0 +1,220 @@
+#pragma once
+
+#include "raylib.h"
+#include "enemy/EnemyTypes.h"
+#include "tower/TowerTypes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// ============================================================
+// Game events
+// ============================================================
+// Plain structs published by the systems. Nothing is delivered
+// immediately: each event type has its own contiguous queue and
+// EventBus::Dispatch() hands every subscriber the whole queue at
+// the end of the tick.
+// ============================================================
+
+struct EnemySpawnRequested {
+    EnemyType type;
+    Vector2 position;
+    float hpMultiplier;
+};
+
+struct EnemyKilled {
+    int reward;
+    Vector2 position;
+    Color color;
+};
+
+struct EnemyReachedBase {
+};
+
+// A projectile landed (splashRadius 0 for single-target shots)
+struct ProjectileImpact {
+    Vector2 position;
+    float splashRadius;
+    Color color;
+};
+
+struct WaveCleared {
+    int wave;
+};
+
+struct BossWarning {
+    int wave;
+};
+
+struct AllWavesCompleted {
+    int wave;
+};
+
+struct GoldChanged {
+    int gold;
+};
+
+struct InsufficientFunds {
+    int cost;
+    int available;
+};
+
+struct TowerSold {
+    TowerType type;
+    int refund;
+};
+
+// ============================================================
+// EventBus: Typed, batched publish/subscribe
+// ============================================================
+// Publish() appends to the event type's queue. Dispatch() swaps
+// each queue out and calls every subscriber once with the whole
+// batch, so 500 kills in one tick cost one call per subscriber.
+// Events published by handlers are delivered in a further round
+// of the same Dispatch(). Queue capacity is kept, so steady-state
+// publishing does not allocate.
+//
+// Subscribe from setup code only - not from inside a handler.
+// Not thread-safe: one bus per game / simulation.
+// ============================================================
+
+class IEventChannel {
+public:
+    virtual ~IEventChannel() = default;
+    virtual bool Flush() = 0;   // Deliver queued events; false if there were none
+    virtual void Clear() = 0;   // Drop queued events
+    virtual size_t Pending() const = 0;
+    virtual size_t MemoryBytes() const = 0;     // Both queues and the handler list
+};
+
+template <typename E>
+class EventChannel : public IEventChannel {
+public:
+    using BatchHandler = std::function<void(const E* events, size_t count)>;
+
+    void Publish(const E& event) {
+        queue.push_back(event);
+    }
+
+    void Subscribe(BatchHandler handler) {
+        handlers.push_back(std::move(handler));
+        queue.reserve(INITIAL_CAPACITY);
+        dispatching.reserve(INITIAL_CAPACITY);
+    }
+
+    bool Flush() override {
+        if (queue.empty()) return false;
+
+        // Handlers may publish more of E; those land in the fresh queue
+        std::swap(queue, dispatching);
+        for (const BatchHandler& handler : handlers) {
+            handler(dispatching.data(), dispatching.size());
+        }
+        dispatching.clear();
+        return true;
+    }
+
+    void Clear() override {
+        queue.clear();
+    }
+
+    size_t Pending() const override { return queue.size(); }
+    
+    size_t MemoryBytes() const override {
+        return (queue.capacity() + dispatching.capacity()) * sizeof(E)
+            + handlers.capacity() * sizeof(BatchHandler);
+    }
+
+    // Events per type per tick before the queue has to grow
+    static constexpr size_t INITIAL_CAPACITY = 256;
+
+private:
+    std::vector<E> queue;
+    std::vector<E> dispatching;
+    std::vector<BatchHandler> handlers;
+};
+
+class EventBus {
+public:
+    EventBus() = default;
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    // Dropped if nothing subscribes to E (no channel is created)
+    template <typename E>
+    void Publish(const E& event) {
+        if (EventChannel<E>* channel = FindChannel<E>()) {
+            channel->Publish(event);
+        }
+    }
+
+    // fn(const E*, size_t) - called once per Dispatch() round with every queued E
+    template <typename E, typename Fn>
+    void SubscribeBatch(Fn&& fn) {
+        Channel<E>().Subscribe(std::forward<Fn>(fn));
+    }
+
+    // fn(const E&) - convenience wrapper looping over the batch
+    template <typename E, typename Fn>
+    void Subscribe(Fn&& fn) {
+        Channel<E>().Subscribe(
+            [handler = std::forward<Fn>(fn)](const E* events, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    handler(events[i]);
+                }
+            }
+        );
+    }
+
+    template <typename E>
+    size_t Pending() {
+        EventChannel<E>* channel = FindChannel<E>();
+        return channel ? channel->Pending() : 0;
+    }
+
+    // Totals over every channel (for memory reports)
+    size_t PendingCount() const;
+    size_t MemoryBytes() const;
+    
+    // Deliver everything queued, including events published by handlers
+    void Dispatch();
+
+    // Drop queued events (subscriptions are kept)
+    void Clear();
+
+    static constexpr int MAX_DISPATCH_ROUNDS = 8;
+
+private:
+    template <typename E>
+    EventChannel<E>* FindChannel() {
+        size_t id = TypeId<E>();
+        return id < channels.size() ? static_cast<EventChannel<E>*>(channels[id].get()) : nullptr;
+    }
+
+    template <typename E>
+    EventChannel<E>& Channel() {
+        size_t id = TypeId<E>();
+        if (id >= channels.size()) {
+            channels.resize(id + 1);
+        }
+        if (!channels[id]) {
+            channels[id] = std::make_unique<EventChannel<E>>();
+        }
+        return *static_cast<EventChannel<E>*>(channels[id].get());
+    }
+
+    // Process-wide id per event type (same id on every bus)
+    template <typename E>
+    static size_t TypeId() {
+        static const size_t id = nextTypeId++;
+        return id;
+    }
+
+    static std::atomic<size_t> nextTypeId;
+
+    std::vector<std::unique_ptr<IEventChannel>> channels;
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+class EventBus;
+class EnemySystem;
+class WaveSystem;
+class TowerSystem;
+class Map;
+
+// ============================================================
+// GameRules: Gameplay wiring shared by Game and Simulation
+// ============================================================
+// Every subscription and callback that decides the outcome of a
+// run lives here, so the headless balance runner plays by exactly
+// the rules of the windowed game:
+//   - spawn requests become enemies
+//   - kills pay out and leave the wave count
+//   - enemies reaching the base cost HP
+//   - cleared waves award their bonus, sold towers refund gold
+//   - tower placement checks the map and spends gold
+// Callers add only presentation (UI, effects, logging) on top.
+// All references are captured: they must outlive the bus.
+// ============================================================
+namespace GameRules {
+    void Connect(EventBus& events, EnemySystem& enemySystem, WaveSystem& waveSystem,
+                 TowerSystem& towerSystem, Map& gameMap, int& playerHP);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <cstddef>
+#include <vector>
+
+// ============================================================
+// MemoryReport: Bytes held per system, with live / peak counts
+// ============================================================
+// Each system adds its own entries from ReportMemory(report):
+// how many items are live, how many it has room for, the size of
+// one item and the bytes it holds (reserved capacity, not just the
+// live part, plus side tables and GPU textures). Entries are kept
+// in a fixed array, so sampling every tick doesn't allocate.
+//
+//     report.Begin();
+//     enemySystem.ReportMemory(report);
+//     towerSystem.ReportMemory(report);
+//
+// Peaks survive Begin() and are cleared by ResetPeaks(). They are
+// matched by position and name, so systems must report in the same
+// order every time.
+// ============================================================
+
+struct MemoryEntry {
+    const char* name = nullptr;     // String literal (stored by pointer)
+    size_t itemBytes = 0;           // One item; 0 if the entry isn't a collection
+    size_t count = 0;               // Live items
+    size_t capacity = 0;            // Items there is room for without growing
+    size_t bytes = 0;               // Everything the entry holds right now
+    size_t peakCount = 0;
+    size_t peakBytes = 0;
+};
+
+class MemoryReport {
+public:
+    MemoryReport();
+    
+    // Start a new sample (keeps peaks)
+    void Begin();
+    void Add(const char* name, size_t itemBytes, size_t count, size_t capacity, size_t bytes);
+    void ResetPeaks();
+    
+    int GetEntryCount() const { return entryCount; }
+    const MemoryEntry& GetEntry(int index) const { return entries[index]; }
+    size_t GetTotalBytes() const { return totalBytes; }
+    size_t GetPeakTotalBytes() const { return peakTotalBytes; }
+    
+    // One TraceLog line per entry, prefixed "MEMORY:" (label, e.g. "wave 7")
+    void Log(const char* label) const;
+    
+    // Heap bytes behind a vector (its capacity, not its size)
+    template <typename T>
+    static size_t VectorBytes(const std::vector<T>& v) { return v.capacity() * sizeof(T); }
+    
+    // Glyph tables, glyph images and the atlas texture of a loaded font
+    static size_t FontBytes(const Font& font);
+    
+    static constexpr int MAX_ENTRIES = 24;
+    
+private:
+    MemoryEntry entries[MAX_ENTRIES];
+    int entryCount;
+    size_t totalBytes;          // Sum over this sample's entries
+    size_t peakTotalBytes;
+};
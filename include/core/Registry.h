@@ -0,0 +1,274 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// ============================================================
+// Registry: Small entity-component store
+// ============================================================
+// Entities are generational IDs; a destroyed entity's slot is
+// reused with a bumped generation, so stale handles are detected
+// instead of aliasing a new entity.
+//
+// Each component type lives in its own ComponentPool: a sparse
+// set whose components are packed in one dense std::vector.
+// Removal swaps the last component into the hole, so iteration
+// is always over contiguous memory with no dead entries.
+// Pointers/references into a pool are invalidated by Add/Remove
+// on that pool, exactly like std::vector.
+// ============================================================
+
+struct Entity {
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+// Type-erased base so the registry can strip any component on Destroy
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+    virtual void Remove(Entity entity) = 0;
+    virtual void Clear() = 0;
+};
+
+template <typename T>
+class ComponentPool : public IComponentPool {
+public:
+    template <typename... Args>
+    T& Add(Entity entity, Args&&... args) {
+        if (entity.index >= sparse.size()) {
+            sparse.resize(entity.index + 1, NOT_PRESENT);
+        }
+        if (sparse[entity.index] != NOT_PRESENT) {
+            // Replace existing component
+            T& existing = components[sparse[entity.index]];
+            existing = T(std::forward<Args>(args)...);
+            owners[sparse[entity.index]] = entity;
+            return existing;
+        }
+        sparse[entity.index] = static_cast<uint32_t>(components.size());
+        owners.push_back(entity);
+        components.emplace_back(std::forward<Args>(args)...);
+        return components.back();
+    }
+
+    bool Has(Entity entity) const {
+        return entity.index < sparse.size()
+            && sparse[entity.index] != NOT_PRESENT
+            && owners[sparse[entity.index]] == entity;
+    }
+
+    T* TryGet(Entity entity) {
+        return Has(entity) ? &components[sparse[entity.index]] : nullptr;
+    }
+
+    const T* TryGet(Entity entity) const {
+        return Has(entity) ? &components[sparse[entity.index]] : nullptr;
+    }
+
+    void Remove(Entity entity) override {
+        if (!Has(entity)) return;
+
+        uint32_t slot = sparse[entity.index];
+        uint32_t last = static_cast<uint32_t>(components.size() - 1);
+        if (slot != last) {
+            components[slot] = std::move(components[last]);
+            owners[slot] = owners[last];
+            sparse[owners[slot].index] = slot;
+        }
+        components.pop_back();
+        owners.pop_back();
+        sparse[entity.index] = NOT_PRESENT;
+    }
+
+    // Preallocate for n components so steady-state Add never reallocates
+    void Reserve(size_t n) {
+        components.reserve(n);
+        owners.reserve(n);
+        sparse.reserve(n);
+    }
+
+    void Clear() override {
+        components.clear();
+        owners.clear();
+        sparse.clear();
+    }
+
+    // Owner of a component given a pointer into this pool (invalid if not ours)
+    Entity EntityOf(const T* component) const {
+        if (components.empty() || component < components.data()
+            || component >= components.data() + components.size()) {
+            return Entity{};
+        }
+        return owners[static_cast<size_t>(component - components.data())];
+    }
+
+    // Dense iteration: Components()[i] belongs to Entities()[i]
+    std::vector<T>& Components() { return components; }
+    const std::vector<T>& Components() const { return components; }
+    const std::vector<Entity>& Entities() const { return owners; }
+    size_t Size() const { return components.size(); }
+    size_t Capacity() const { return components.capacity(); }
+
+    // Heap bytes held by the dense arrays and the sparse index
+    size_t MemoryBytes() const {
+        return components.capacity() * sizeof(T)
+            + owners.capacity() * sizeof(Entity)
+            + sparse.capacity() * sizeof(uint32_t);
+    }
+
+private:
+    static constexpr uint32_t NOT_PRESENT = 0xFFFFFFFFu;
+
+    std::vector<T> components;
+    std::vector<Entity> owners;
+    std::vector<uint32_t> sparse;   // entity index -> dense slot
+};
+
+class Registry {
+public:
+    explicit Registry(size_t entityCapacity = DEFAULT_ENTITY_CAPACITY) { ReserveEntities(entityCapacity); }
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    // -------------------- Entities --------------------
+
+    Entity Create();
+    void Destroy(Entity entity);
+    bool IsAlive(Entity entity) const;
+    size_t AliveCount() const { return generations.size() - freeList.size(); }
+    size_t EntityCapacity() const { return generations.capacity(); }
+
+    // Entity bookkeeping only; each pool reports its own MemoryBytes()
+    size_t MemoryBytes() const;
+
+    // Preallocate bookkeeping for n entities (capacity survives Destroy/DestroyAll)
+    void ReserveEntities(size_t n);
+
+    // -------------------- Components --------------------
+
+    template <typename T, typename... Args>
+    T& Emplace(Entity entity, Args&&... args) {
+        return Pool<T>().Add(entity, std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    bool Has(Entity entity) const {
+        const ComponentPool<T>* pool = FindPool<T>();
+        return pool && pool->Has(entity);
+    }
+
+    template <typename T>
+    T* TryGet(Entity entity) {
+        ComponentPool<T>* pool = FindPool<T>();
+        return pool ? pool->TryGet(entity) : nullptr;
+    }
+
+    template <typename T>
+    const T* TryGet(Entity entity) const {
+        const ComponentPool<T>* pool = FindPool<T>();
+        return pool ? pool->TryGet(entity) : nullptr;
+    }
+
+    template <typename T>
+    void Remove(Entity entity) {
+        if (ComponentPool<T>* pool = FindPool<T>()) pool->Remove(entity);
+    }
+
+    // Pool for T, created on first use
+    template <typename T>
+    ComponentPool<T>& Pool() {
+        size_t id = TypeId<T>();
+        if (id >= pools.size()) {
+            pools.resize(id + 1);
+        }
+        if (!pools[id]) {
+            pools[id] = std::make_unique<ComponentPool<T>>();
+        }
+        return *static_cast<ComponentPool<T>*>(pools[id].get());
+    }
+
+    // -------------------- Views --------------------
+
+    // Call fn(Entity, First&, Rest&...) for every entity that has all listed
+    // components. Iterates First's dense array; put the rarest type first.
+    // fn must not add or remove components of the viewed types.
+    template <typename First, typename... Rest, typename Fn>
+    void Each(Fn&& fn) {
+        ComponentPool<First>& first = Pool<First>();
+        std::vector<First>& components = first.Components();
+        const std::vector<Entity>& owners = first.Entities();
+        for (size_t i = 0; i < components.size(); ++i) {
+            Entity entity = owners[i];
+            if constexpr (sizeof...(Rest) == 0) {
+                fn(entity, components[i]);
+            } else {
+                if ((Has<Rest>(entity) && ...)) {
+                    fn(entity, components[i], *TryGet<Rest>(entity)...);
+                }
+            }
+        }
+    }
+
+    // Destroy every entity whose T component matches pred.
+    // Walks the dense array backwards so swap-removal never skips an entry.
+    template <typename T, typename Pred>
+    size_t DestroyIf(Pred&& pred) {
+        ComponentPool<T>& pool = Pool<T>();
+        size_t destroyed = 0;
+        for (size_t i = pool.Size(); i-- > 0;) {
+            if (pred(pool.Components()[i])) {
+                Destroy(pool.Entities()[i]);
+                ++destroyed;
+            }
+        }
+        return destroyed;
+    }
+
+    // Destroy every entity that owns a T
+    template <typename T>
+    void DestroyAll() {
+        ComponentPool<T>& pool = Pool<T>();
+        while (pool.Size() > 0) {
+            Destroy(pool.Entities().back());
+        }
+    }
+
+private:
+    template <typename T>
+    ComponentPool<T>* FindPool() {
+        size_t id = TypeId<T>();
+        return id < pools.size() ? static_cast<ComponentPool<T>*>(pools[id].get()) : nullptr;
+    }
+
+    template <typename T>
+    const ComponentPool<T>* FindPool() const {
+        size_t id = TypeId<T>();
+        return id < pools.size() ? static_cast<const ComponentPool<T>*>(pools[id].get()) : nullptr;
+    }
+
+    // Process-wide id per component type (same id in every registry)
+    template <typename T>
+    static size_t TypeId() {
+        static const size_t id = nextTypeId++;
+        return id;
+    }
+
+    static std::atomic<size_t> nextTypeId;
+    static constexpr size_t DEFAULT_ENTITY_CAPACITY = 1024;
+
+    std::vector<uint32_t> generations;  // Current generation per slot
+    std::vector<uint8_t> alive;         // 1 if slot holds a live entity
+    std::vector<uint32_t> freeList;     // Reusable slots
+    std::vector<std::unique_ptr<IComponentPool>> pools;
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "core/Registry.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// ============================================================
+// TimingWheel: Hierarchical timer wheel keyed by entity
+// ============================================================
+// Schedules entities for a future tick. Level 0 has one slot per
+// tick for the next LEVEL0_SLOTS ticks; level 1 has one slot per
+// LEVEL0_SLOTS ticks and is cascaded into level 0 as each block
+// begins. Advance() only touches the slots of the ticks it passes,
+// so an entity costs nothing between being scheduled and coming
+// due. Ticks past the level-1 horizon wait in their level-1 slot
+// until their block comes round.
+//
+// Entries are intrusive doubly linked lists through a node array
+// indexed by Entity::index: Schedule / Cancel are O(1) and never
+// allocate once Reserve() covers the entity indices in use.
+//
+// The simulation clocks that drive wheels step in TICK seconds;
+// TickAt / TicksFor are the one rounding rule from seconds to ticks.
+// ============================================================
+class TimingWheel {
+public:
+    TimingWheel();
+    
+    // Room for entity indices [0, n) without allocating
+    void Reserve(size_t n);
+    
+    // Fire entity at tick (clamped to Now() + 1); replaces any earlier schedule
+    void Schedule(Entity entity, uint32_t tick);
+    void Cancel(Entity entity);
+    bool IsScheduled(Entity entity) const;
+    uint32_t GetTick(Entity entity) const;     // Only meaningful if IsScheduled()
+    
+    uint32_t Now() const { return now; }
+    
+    // Node table (heap) plus the slot heads
+    size_t MemoryBytes() const { return nodes.capacity() * sizeof(Node) + sizeof(heads); }
+    
+    // Step to tick, calling onDue(Entity) for every entry that comes due, in tick
+    // order. onDue may Schedule() / Cancel() any entity, including ones due in
+    // the same tick that have not been delivered yet.
+    template <typename Fn>
+    void Advance(uint32_t tick, Fn&& onDue) {
+        while (now < tick) {
+            now++;
+            if ((now & LEVEL0_MASK) == 0) {
+                Cascade();
+            }
+            
+            // Unlink one entry at a time, so the rest stay cancellable. Nothing
+            // scheduled from onDue lands in this slot: ticks are at least now + 1,
+            // and now + LEVEL0_SLOTS goes to level 1.
+            uint32_t slot = now & LEVEL0_MASK;
+            while (heads[slot] != NONE) {
+                uint32_t id = heads[slot];
+                Unlink(id);
+                onDue(nodes[id].entity);
+            }
+        }
+    }
+    
+    // Drop every entry and restart at tick 0
+    void Clear();
+    
+    // Tick a clock reading falls in (rounded down)
+    static uint32_t TickAt(double time) {
+        return static_cast<uint32_t>(time / TICK + TICK_EPSILON);
+    }
+    
+    // Ticks until `seconds` have passed (rounded up); for an absolute time,
+    // the first tick at or after it
+    static uint32_t TicksFor(double seconds) {
+        return static_cast<uint32_t>(std::ceil(seconds / TICK - TICK_EPSILON));
+    }
+    
+    static constexpr float TICK = 1.0f / 60.0f;
+    static constexpr double TICK_EPSILON = 1e-4;    // Absorbs float drift in accumulated dt
+    
+    static constexpr uint32_t LEVEL0_BITS = 8;
+    static constexpr uint32_t LEVEL0_SLOTS = 1u << LEVEL0_BITS;   // 256 ticks
+    static constexpr uint32_t LEVEL1_SLOTS = 64;                  // x 256 ticks
+    
+private:
+    struct Node {
+        Entity entity;
+        uint32_t prev = 0;
+        uint32_t next = 0;
+        uint32_t tick = 0;
+        uint32_t slot = 0;
+        bool scheduled = false;
+    };
+    
+    void Link(uint32_t id, uint32_t slot);
+    void Unlink(uint32_t id);
+    void Cascade();
+    
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+    static constexpr uint32_t LEVEL0_MASK = LEVEL0_SLOTS - 1;
+    
+    std::vector<Node> nodes;
+    uint32_t heads[LEVEL0_SLOTS + LEVEL1_SLOTS];
+    uint32_t now;
+};
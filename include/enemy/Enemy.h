@@ -3,9 +3,18 @@
 #include "raylib.h"
 #include "EnemyTypes.h"
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
+struct Enemy;
+
+// Event hooks shared by every enemy of one system (wired by a higher-level system).
+struct EnemyEvents {
+    std::function<void(const Enemy&)> onDeath;  // Called once when an enemy dies
+    std::function<void()> onReachedEnd;  // Called once when an enemy reaches final waypoint
+};
+
 // Represents a single enemy instance (data + behavior).
 struct Enemy {
     // Core stats
@@ -15,17 +24,30 @@ struct Enemy {
     EnemyType type = EnemyType::NORMAL;
     int reward = 0;
 
-    // Movement/path tracking
-    Vector2 position{ 0, 0 };
-    int currentWaypointIndex = 0;
+    // Movement/path tracking. Movement is analytic: distance along the path at
+    // time t is baseDistance + speed * (t - baseTime); EnemyManager re-bases it
+    // when speed changes and fills in position/distance only when asked.
+    float baseDistance = 0.0f;
+    double baseTime = 0.0;      // EnemyManager clock when baseDistance was taken
+    Vector2 position{ 0, 0 };   // As of positionTime (see EnemyManager::ResolvePositions)
+    float distance = 0.0f;      // Along the path from the spawn, same moment as position
+    double positionTime = -1.0; // EnemyManager clock position/distance were evaluated at
+    float laneOffset = 0.0f;    // Off the path centre line along its normal (crowd separation)
+    float pathOffset = 0.0f;    // Ahead/behind baseDistance along the path (crowd separation;
+                                // shown in position/distance only, never moves the arrival)
+
+    // Slow (frost): speed is baseSpeed * (1 - slowAmount) until slowUntilTick,
+    // when EnemyManager puts it back to baseSpeed. Slows don't stack.
+    float baseSpeed = 0.0f;
+    float slowAmount = 0.0f;
+    uint32_t slowUntilTick = 0; // EnemyManager tick the slow wears off
 
     // State flags
     bool alive = true;
     bool rewardGiven = false;
 
-    // Events/callbacks (wired by a higher-level system)
-    std::function<void(int)> onDeath;    // Called once when enemy dies (passes reward)
-    std::function<void()> onReachedEnd;  // Called once when enemy reaches final waypoint
+    // Events (owned by the spawning system; one pointer instead of per-enemy callbacks)
+    const EnemyEvents* events = nullptr;
 
     // Rendering (simple shapes for now)
     float radius = 12.0f;
@@ -39,8 +61,4 @@ struct Enemy {
 
     // Draw enemy and optionally an HP bar.
     void Draw(bool drawHpBar = true) const;
-
-    // Move along the waypoint path using dt.
-    // Returns true if the enemy reached the end this update.
-    bool Update(float dt, const std::vector<Vector2>& waypoints);
 };
@@ -1,19 +1,72 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include "Enemy.h"
+#include "EnemyMovement.h"
+#include "core/Registry.h"
+#include "core/TimingWheel.h"
+#include "utils/SpatialGrid.h"
+
+class MemoryReport;
 
 // Owns and updates a collection of enemies.
+// Enemies are Enemy components on the shared Registry; each enemy is one entity.
+//
+// Enemies are not integrated per tick: each stores a base distance and time
+// (see Enemy), and its arrival at the base is scheduled on a timing wheel when
+// it spawns or changes speed. Update() only advances the clock, fires the
+// arrivals that came due and removes the dead, so its cost does not depend on
+// how many enemies are walking. Positions are evaluated in one batched pass
+// (ResolvePositions) when targeting or drawing needs them, at most once per
+// tick, and only for enemies on the stretches of path the caller looks at
+// (tower ranges, the view): enemies nobody can see or shoot cost nothing.
+//
+// Crowds spread out: each enemy walks at a lane offset from the path centre
+// line, and ResolvePositions pushes enemies closer than SEPARATION_RADIUS
+// apart (at most MAX_NEIGHBORS neighbours each, from a uniform grid) -
+// sideways by steering the lane offset, along the path by steering a path
+// offset. Both only shift where an enemy is shown and targeted; the base
+// distance and arrival never depend on how often positions were resolved.
+// Past SEPARATION_BUDGET enemies a rotating slice is steered per pass, so the
+// cost per tick stays fixed.
 class EnemyManager {
 public:
-    // Adds a new enemy instance into the internal list.
-    void AddEnemy(const Enemy& e);
+    explicit EnemyManager(Registry& registry);
+
+    // Path the enemies walk (kept by pointer; must outlive its use here).
+    // Re-schedules every enemy's arrival.
+    void SetPath(const PathSamples* samples);
+
+    // Adds a new enemy entity at the start of the path and returns its handle.
+    Entity AddEnemy(const Enemy& e);
+
+    // Advances the clock; enemies reaching the end of the path fire
+    // onReachedEnd, then the dead are removed.
+    void Update(float dt);
+
+    // Changes an enemy's speed from now on (re-bases its distance and arrival).
+    void SetSpeed(Enemy& enemy, float speed);
 
-    // Updates all enemies; dt is delta time.
-    void Update(float dt, const std::vector<Vector2>& waypoints);
+    // Slows an enemy to baseSpeed * (1 - amount) for duration seconds. The
+    // strongest active slow wins and a new hit can only extend the time left;
+    // full speed comes back when it runs out.
+    void ApplySlow(Enemy& enemy, float amount, float duration);
 
-    // Draws all enemies.
-    void Draw() const;
+    // Call when an enemy is killed (it is removed on the next Update).
+    void OnEnemyDied() { pendingRemovals++; }
+
+    // Brings the position and distance of every enemy walking inside ranges
+    // (normalized) up to the current clock (batched, see EnemyMovement).
+    // Enemies already current are skipped; the rest keep stale positions.
+    void ResolvePositions(const PathRanges& ranges);
+
+    // True if the enemy's position / distance are those at the current clock
+    bool IsPositionCurrent(const Enemy& e) const { return e.positionTime == clock; }
+
+    // Draws the enemies inside view (world rectangle on screen); resolves the
+    // stretches of path in view first.
+    void Draw(Rectangle view);
 
     // Returns number of currently alive enemies (size of list).
     int AliveCount() const;
@@ -21,13 +74,74 @@ public:
     // True if there are no enemies left.
     bool IsEmpty() const;
 
-    // Clears all enemies (useful on reset / game over / victory).
+    // Destroys all enemy entities (useful on reset / game over / victory).
     void Clear();
     
-    // Get access to enemies for tower targeting
-    std::vector<Enemy>& GetEnemies() { return enemies; }
-    const std::vector<Enemy>& GetEnemies() const { return enemies; }
+    // Get access to enemies for tower targeting (dense component array).
+    // Only positions with IsPositionCurrent() are up to date.
+    std::vector<Enemy>& GetEnemies() { return pool.Components(); }
+    const std::vector<Enemy>& GetEnemies() const { return pool.Components(); }
+
+    // Entity handle owning GetEnemies()[i]
+    const std::vector<Entity>& GetEntities() const { return pool.Entities(); }
+
+    double GetClock() const { return clock; }
+
+    // Path the enemies walk (nullptr before SetPath); the version changes with every SetPath
+    const PathSamples* GetPath() const { return path; }
+    uint32_t GetPathVersion() const { return pathVersion; }
+
+    // Furthest an enemy walks off the path centre line (stays on a 64 px path tile)
+    static constexpr float MAX_LANE_OFFSET = 22.0f;
+
+    // "Enemies": the component pool plus movement scratch, arrival wheel and crowd grid
+    void ReportMemory(MemoryReport& report) const;
 
 private:
-    std::vector<Enemy> enemies;
+    // Schedule (or cancel, if it never gets there) the enemy's arrival at the base
+    void ScheduleArrival(Entity entity, const Enemy& e);
+
+    // Push crowded enemies apart, each over its moveStep seconds (on the move* arrays)
+    void SeparateCrowd(size_t count);
+
+    Registry& registry;
+    ComponentPool<Enemy>& pool;
+    const PathSamples* path;
+    uint32_t pathVersion;
+
+    double clock;
+    uint32_t currentTick;
+    TimingWheel arrivals;
+    TimingWheel slowExpiries;
+    int pendingRemovals;
+    size_t separationCursor;        // First enemy of the next slice past the budget
+    SpatialGrid crowdGrid;
+
+    // Stretches of path in the last drawn view
+    PathRanges viewRanges;
+    Rectangle rangesView;
+    uint32_t rangesPathVersion;
+
+    // Structure-of-arrays scratch for the position pass (capacity kept between
+    // ticks), one entry per enemy being resolved; moveIndex is its GetEnemies() index
+    std::vector<uint32_t> moveIndex;
+    std::vector<float> moveStep;
+    std::vector<float> moveX;
+    std::vector<float> moveY;
+    std::vector<float> moveDistance;
+    std::vector<float> moveOffset;
+    std::vector<float> movePathOffset;
+
+    // Enough for the largest scripted wave alive at once; only endless mode grows past it.
+    static constexpr size_t INITIAL_CAPACITY = 512;
+
+    static constexpr float SEPARATION_RADIUS = 20.0f;   // Centres closer than this push apart
+    static constexpr float SEPARATION_SPEED = 60.0f;    // Sideways px/s at full overlap
+    static constexpr float LANE_RECENTER = 0.5f;        // Pull back to the centre line, per second
+    static constexpr float PATH_PUSH_SCALE = 0.5f;      // Along-path push relative to sideways
+    static constexpr float MAX_PATH_OFFSET = 20.0f;     // Drawn at most this far off the walked distance
+    static constexpr float MAX_SEPARATION_STEP = 0.1f;  // Longer gaps between passes are capped
+    static constexpr int MAX_NEIGHBORS = 8;
+    static constexpr size_t SEPARATION_BUDGET = 2048;   // Enemies steered per pass
+    static constexpr float DRAW_MARGIN = 32.0f;         // Enemy radius and the HP bar above it
 };
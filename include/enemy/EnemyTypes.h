@@ -1,8 +1,61 @@
 #pragma once
 
+#include "raylib.h"
+
 enum class EnemyType {
     NORMAL,     // Void Walker - Balanced enemy
     FAST,       // Abyss Rusher - Quick but fragile
     TANK,       // Heavy Voidborn - Slow but durable
-    BOSS        // Abyss Lord - Final boss, very high HP
+    BOSS,       // Abyss Lord - Final boss, very high HP
+
+    COUNT       // Number of enemy types (not a real type)
+};
+
+constexpr int ENEMY_TYPE_COUNT = static_cast<int>(EnemyType::COUNT);
+
+// Base stats for an enemy type (tweak values freely)
+struct EnemyStats {
+    float maxHp;
+    float speed;
+    int reward;
+    float radius;
+    Color color;
+};
+
+// One row per EnemyType, in enum order
+struct EnemyTypeInfo {
+    EnemyType type;
+    const char* name;
+    EnemyStats stats;
 };
+
+inline constexpr EnemyTypeInfo ENEMY_TYPES[] = {
+    //                                      maxHp    speed  reward  radius  color
+    { EnemyType::NORMAL, "Void Walker",    {  100.0f,  80.0f,  10,   12.0f, {230, 41, 55, 255} } },   // RED
+    { EnemyType::FAST,   "Abyss Rusher",   {   60.0f, 130.0f,   6,   10.0f, {255, 161, 0, 255} } },   // ORANGE
+    { EnemyType::TANK,   "Heavy Voidborn", {  220.0f,  45.0f,  20,   15.0f, {0, 117, 44, 255} } },    // DARKGREEN
+    { EnemyType::BOSS,   "Abyss Lord",     { 1000.0f,  35.0f, 200,   25.0f, {200, 122, 255, 255} } }, // PURPLE
+};
+
+constexpr bool ValidateEnemyTypes() {
+    for (int i = 0; i < ENEMY_TYPE_COUNT; ++i) {
+        const EnemyTypeInfo& info = ENEMY_TYPES[i];
+        if (static_cast<int>(info.type) != i) return false;
+        if (info.stats.maxHp <= 0.0f || info.stats.speed <= 0.0f || info.stats.radius <= 0.0f) return false;
+        if (info.stats.reward < 0) return false;
+    }
+    return true;
+}
+
+static_assert(sizeof(ENEMY_TYPES) / sizeof(ENEMY_TYPES[0]) == ENEMY_TYPE_COUNT,
+              "ENEMY_TYPES needs exactly one row per EnemyType");
+static_assert(ValidateEnemyTypes(),
+              "ENEMY_TYPES rows must be in enum order with positive hp/speed/radius");
+
+constexpr const EnemyStats& GetEnemyStats(EnemyType type) {
+    return ENEMY_TYPES[static_cast<int>(type)].stats;
+}
+
+constexpr const char* GetEnemyName(EnemyType type) {
+    return ENEMY_TYPES[static_cast<int>(type)].name;
+}
@@ -1,100 +1,141 @@
 #pragma once
 
 #include "raylib.h"
+#include "tower/TowerTypes.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 
+class MemoryReport;
+
 // ============================================================
 // TileType: Types of tiles on the map
 // ============================================================
-enum class TileType {
+enum class TileType : uint8_t {
     EMPTY,          // Can place towers here
     PATH,           // Enemy path - cannot place towers
-    BLOCKED,        // Decorative/blocked area
+    BLOCKED,        // Decorative/blocked area (also: outside the map)
     WATER,          // Deep water (background)
     SPAWN,          // Enemy spawn point
     BASE            // Player base (Aria's location)
 };
 
-// ============================================================
-// Tile: A single map tile
-// ============================================================
-struct Tile {
-    TileType type;
-    int gridX;
-    int gridY;
-    Rectangle bounds;
-    Color color;
-    
-    Tile()
-        : type(TileType::EMPTY)
-        , gridX(0)
-        , gridY(0)
-        , bounds{0, 0, 0, 0}
-        , color(DARKBLUE)
-    {}
-    
-    Tile(TileType t, int gx, int gy, Rectangle b)
-        : type(t)
-        , gridX(gx)
-        , gridY(gy)
-        , bounds(b)
-    {
-        // Set color based on type
-        switch (type) {
-            case TileType::EMPTY:
-                color = {30, 60, 90, 255};      // Dark blue-gray
-                break;
-            case TileType::PATH:
-                color = {80, 70, 60, 255};      // Sandy path
-                break;
-            case TileType::BLOCKED:
-                color = {20, 40, 60, 255};      // Darker blue
-                break;
-            case TileType::WATER:
-                color = {15, 30, 50, 255};      // Deep water
-                break;
-            case TileType::SPAWN:
-                color = {100, 50, 80, 255};     // Purple-ish
-                break;
-            case TileType::BASE:
-                color = {60, 120, 100, 255};    // Teal
-                break;
-        }
+// Fill color per tile type
+constexpr Color GetTileColor(TileType type) {
+    switch (type) {
+        case TileType::EMPTY:   return {30, 60, 90, 255};      // Dark blue-gray
+        case TileType::PATH:    return {80, 70, 60, 255};      // Sandy path
+        case TileType::BLOCKED: return {20, 40, 60, 255};      // Darker blue
+        case TileType::WATER:   return {15, 30, 50, 255};      // Deep water
+        case TileType::SPAWN:   return {100, 50, 80, 255};     // Purple-ish
+        case TileType::BASE:    return {60, 120, 100, 255};    // Teal
     }
-};
+    return DARKBLUE;
+}
 
 // ============================================================
 // Map: Grid-based map for the game
 // ============================================================
+// Tiles and waypoints are in world space; the game draws the map
+// through its camera (CameraSystem), so a map may be any number
+// of tiles and larger than the screen.
+//
+// Tiles live in CHUNK_SIZE x CHUNK_SIZE chunks behind a flat chunk
+// directory, so a tile lookup is two divisions and an index. A
+// chunk is only created the first time something touches it: its
+// tiles come from the map's terrain generator and its path
+// coverage is computed then. Memory and load time therefore scale
+// with the area that is actually queried or viewed, not with the
+// map size. Untouched chunks that were never edited can be dropped
+// again (they regenerate on demand); edited chunks stay resident.
+//
+// For drawing, StreamChunks(view) bakes the chunks around the view
+// into render textures (at most MAX_BAKES_PER_FRAME per call). Once
+// TEXTURE_BUDGET_BYTES is reached, a new bake takes over the texture
+// of the least recently viewed chunk off screen; chunks in view are
+// never given up. Draw(view) then draws one
+// texture per visible chunk, falling back to per-tile drawing for
+// chunks that are not baked. Call StreamChunks outside BeginMode2D.
+//
+// Tile queries are const but may load chunks (the directory is a
+// cache, hence mutable).
+// ============================================================
 class Map {
 public:
     Map();
+    ~Map();
     
-    // Initialize map with default layout
+    Map(const Map&) = delete;
+    Map& operator=(const Map&) = delete;
+    
+    // Initialize map with default layout (sized to fit the given screen)
     void Init(int screenWidth, int screenHeight);
     
-    // Load map from file (future feature)
+    // Load a tile grid from a text file: one line per row, one character per
+    // tile ('.' empty, '#' path, 'S' spawn, 'B' base, '~' water, 'X' blocked;
+    // short rows are padded with water). Waypoints come from ExtractPath().
+    // Returns false if the file can't be read, has an unknown character or
+    // no path from a spawn to a base.
     bool LoadFromFile(const char* filename);
     
-    // Drawing
+    // Rebuild the waypoints from SPAWN / PATH / BASE tiles: the shortest
+    // 4-connected walk from the spawn to a base, with straight runs merged
+    // into single segments. False (and no waypoints) if there is no such walk.
+    // Starts from the spawn recorded by SetTile / LoadFromFile and only loads
+    // the chunks the walk reaches.
+    bool ExtractPath();
+    
+    // Load / bake / evict chunks around the view (world rectangle on screen).
+    // Needs a window (render textures); call once per frame before BeginMode2D.
+    void StreamChunks(Rectangle view);
+    
+    // Drawing (view: world rectangle on screen; tiles outside it are skipped)
     void Draw() const;
+    void Draw(Rectangle view) const;
     void DrawGrid() const;
+    void DrawGrid(Rectangle view) const;
     
-    // Tile queries
-    Tile* GetTileAt(Vector2 worldPos);
-    const Tile* GetTileAt(Vector2 worldPos) const;
-    Tile* GetTileAtGrid(int gridX, int gridY);
-    const Tile* GetTileAtGrid(int gridX, int gridY) const;
+    // Tile queries (BLOCKED outside the map)
+    TileType GetTileAt(Vector2 worldPos) const;
+    TileType GetTileAtGrid(int gridX, int gridY) const;
+    bool IsInside(int gridX, int gridY) const;
+    
+    // Edit a tile (its chunk stays resident from then on)
+    void SetTile(int gridX, int gridY, TileType type);
     
     // Placement validation
     bool CanPlaceTower(Vector2 worldPos) const;
     Vector2 SnapToGrid(Vector2 worldPos) const;
     Vector2 GetTileCenter(int gridX, int gridY) const;
     
+    // Path coverage: length of path (pixels) inside a tower's range if placed
+    // at this tile's center. Computed per chunk on load, 0 for non-buildable tiles.
+    float GetPathCoverage(int gridX, int gridY, TowerType type) const;
+    float GetPathCoverageAt(Vector2 worldPos, TowerType type) const;
+    
     // Getters
     int GetGridWidth() const { return gridWidth; }
     int GetGridHeight() const { return gridHeight; }
     int GetTileSize() const { return tileSize; }
+    Rectangle GetWorldBounds() const;
+    
+    // Chunk stats
+    int GetResidentChunkCount() const { return residentChunks; }
+    int GetBakedChunkCount() const { return bakedChunks; }
+    size_t GetTextureBytes() const { return textureBytes; }
+    
+    // "Map chunks" (tile and coverage data, directory, path) and "Map textures" (baked, GPU)
+    void ReportMemory(MemoryReport& report) const;
+    
+    static constexpr int DEFAULT_TILE_SIZE = 64;
+    static constexpr int CHUNK_SIZE = 16;                           // Tiles per chunk side
+    static constexpr int CHUNK_TILES = CHUNK_SIZE * CHUNK_SIZE;
+    static constexpr size_t TEXTURE_BUDGET_BYTES = 128u * 1024 * 1024;
+    static constexpr int MAX_RESIDENT_CHUNKS = 4096;                // Soft cap on tile data
+    static constexpr int MAX_BAKES_PER_FRAME = 4;                   // Chunk redraws per StreamChunks
+    static constexpr float PATH_MESH_SPACING = 8.0f;                // Arc length between path mesh samples
+    static constexpr float PATH_MESH_WIDTH = 3.0f;
     
     // Get path waypoints
     const std::vector<Vector2>& GetWaypoints() const { return waypoints; }
@@ -105,11 +146,54 @@ public:
     void Clear();
     
 private:
+    struct Chunk {
+        TileType tiles[CHUNK_TILES];
+        uint16_t coverage[CHUNK_TILES * TOWER_TYPE_COUNT];  // [tile * TOWER_TYPE_COUNT + type]
+        uint32_t coverageVersion = 0;   // == pathVersion when coverage is current
+        uint64_t lastUsed = 0;          // Frame of last view / query (LRU)
+        bool edited = false;            // Changed after generation: never evicted
+        bool baked = false;
+        RenderTexture2D texture{};
+    };
+    
+    // Terrain for untouched tiles (x, y in grid coordinates)
+    using TerrainFn = std::function<TileType(int, int)>;
+    
+    void Reset(int width, int height, int size, TerrainFn generator);
     void CreateDefaultMap();
-    void SetupPath();
+    void OnPathChanged();
+    void BuildPathMesh();
+    
+    // Chunk directory
+    int ChunkIndex(int gridX, int gridY) const;
+    Chunk& GetChunk(int chunkIndex) const;              // Loads if needed
+    void ComputeCoverage(int chunkIndex, Chunk& chunk) const;
+    void BakeChunk(int chunkIndex, Chunk& chunk);
+    void UnbakeChunk(Chunk& chunk);
+    void EvictChunks();
+    void DrawChunkTiles(int chunkIndex, const Chunk& chunk, Rectangle view) const;
+    
+    // World -> grid coordinates (floored, so positions left/above the map are negative)
+    int GridX(float worldX) const;
+    int GridY(float worldY) const;
+    
+    // Inclusive tile range overlapping a world rectangle, clamped to the map
+    void GetTileRange(Rectangle view, int& x0, int& y0, int& x1, int& y1) const;
+    
+    mutable std::vector<std::unique_ptr<Chunk>> chunks;    // chunksX * chunksY, null = not loaded
+    mutable int residentChunks;
+    mutable uint64_t frame;
+    int chunksX;
+    int chunksY;
+    TerrainFn terrain;
+    
+    int bakedChunks;
+    size_t textureBytes;
     
-    std::vector<std::vector<Tile>> tiles;
     std::vector<Vector2> waypoints;
+    uint32_t pathVersion;       // Bumped when waypoints change; stale chunk coverage is recomputed
+    std::vector<Vector2> pathCurve; // Smoothed path (Path::Tessellate, PATH_MESH_SPACING apart): mesh and coverage
+    std::vector<Vector2> pathMesh;  // Triangle strip along pathCurve, rebuilt with it
     
     int gridWidth;
     int gridHeight;
@@ -119,4 +203,5 @@ private:
     
     Vector2 spawnPoint;
     Vector2 basePoint;
+    int spawnTile;              // Grid index (y * gridWidth + x) of the SPAWN tile, -1 if none
 };
@@ -6,7 +6,10 @@
 // ============================================================
 // Path: Manages enemy pathfinding waypoints
 // ============================================================
-// Simple waypoint-based path for enemies to follow
+// Simple waypoint-based path for enemies to follow. Cumulative
+// arc lengths are cached whenever the waypoints change, so
+// position-at-distance is a binary search rather than a walk
+// over every segment.
 // ============================================================
 
 class Path {
@@ -27,12 +30,34 @@ public:
     Vector2 GetSpawnPoint() const;
     Vector2 GetEndPoint() const;
     
-    // Calculate total path length
-    float GetTotalLength() const;
+    // Total path length (cached)
+    float GetTotalLength() const { return cumulative.empty() ? 0.0f : cumulative.back(); }
+    
+    // Distance from the start to waypoint index (cached)
+    float GetDistanceToWaypoint(int index) const;
     
     // Get position along path (0.0 = start, 1.0 = end)
     Vector2 GetPositionAlongPath(float t) const;
     
+    // Position at a distance from the start (clamped to the path)
+    Vector2 GetPositionAtDistance(float distance) const;
+    
+    // Segment (waypoint index -> index + 1) containing a distance
+    int GetSegmentAtDistance(float distance) const;
+    
+    // Distance from the start of the closest point on the path to 'point'
+    float GetDistanceOfPoint(Vector2 point) const;
+    
+    // Same, for a point known to be on 'segment': O(1)
+    float GetDistanceOfPoint(Vector2 point, int segment) const;
+    
+    // Centripetal Catmull-Rom curve through the waypoints, resampled at equal
+    // arc-length steps of about `spacing` px (first and last sample are the path
+    // ends). Straight runs stay straight; the curve bends within about
+    // cornerRadius of each corner (0: a plain spline through the waypoints).
+    // Returns the exact step used; 0 with no samples for an empty path.
+    float Tessellate(float spacing, std::vector<Vector2>& outSamples, float cornerRadius = CORNER_RADIUS) const;
+    
     // Drawing (for debug)
     void Draw(Color color = WHITE, float thickness = 2.0f) const;
     void DrawWaypoints(Color color = YELLOW, float radius = 5.0f) const;
@@ -40,8 +65,13 @@ public:
     // Validation
     bool IsValid() const { return waypoints.size() >= 2; }
     
+    static constexpr float CORNER_RADIUS = 24.0f;   // Default bend radius: stays inside a 64 px path tile
+    
 private:
+    void RebuildLengths();
+    
     std::vector<Vector2> waypoints;
+    std::vector<float> cumulative;   // cumulative[i] = distance from the start to waypoints[i]
 };
 
 // ============================================================
@@ -0,0 +1,21 @@
+#pragma once
+
+// ============================================================
+// AllocationCheck: Zero-allocation check for the simulation tick
+// ============================================================
+// Plays a full 10-wave game on a headless Simulation with a
+// sampled tower layout. After the warm-up waves, every Step()
+// runs with AllocationTracker counting; any global heap
+// allocation fails the check and is reported per system.
+// Needs a build with GOTD_TRACK_ALLOCATIONS.
+//
+// Usage: GuardiansOfTheDeep --alloc-check [--seed=N] [--budget=N]
+//        [--warmup=WAVES] [--map=FILE]
+// Exit code: 0 pass, 1 allocations found / bad option, 2 tracking
+// not compiled in.
+// ============================================================
+
+namespace AllocationCheck {
+    // Entry point for `--alloc-check`; argv excludes the program name and flag
+    int RunFromCommandLine(int argc, char** argv);
+}
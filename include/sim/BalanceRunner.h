@@ -0,0 +1,77 @@
+#pragma once
+
+#include "tower/TowerTypes.h"
+
+#include <random>
+#include <vector>
+
+class Map;
+
+// ============================================================
+// BalanceRunner: Monte Carlo evaluation of tower layouts
+// ============================================================
+// Samples tower layouts that fit a gold budget on the map's
+// buildable tiles, plays every layout through all waves with
+// several RNG seeds on headless Simulations (one per worker
+// thread), and reports win rate and HP-left distribution.
+// Runs that hit maxSeconds undecided are counted as timeouts and
+// left out of the win rate and the HP figures.
+//
+// Usage: GuardiansOfTheDeep --balance [--budget=N] [--layouts=N]
+//        [--runs=N] [--seed=N] [--threads=N] [--map=FILE] [--weighted]
+// ============================================================
+
+struct TowerPlacement {
+    TowerType type;
+    int gridX;
+    int gridY;
+};
+
+struct BalanceConfig {
+    const char* mapFile = nullptr;  // nullptr = default map
+    int budget = 300;               // Gold available for the layout
+    int layoutCount = 64;           // Layouts to sample
+    int runsPerLayout = 8;          // Seeds per layout
+    unsigned int seed = 1;          // Base seed (layouts and runs derive from it)
+    int threads = 0;                // 0 = one per hardware thread
+    float dt = 1.0f / 60.0f;        // Fixed sim step
+    float maxSeconds = 1800.0f;     // Game-time cap per run
+    bool coverageWeighted = false;  // Prefer tiles covering more path
+};
+
+struct LayoutReport {
+    std::vector<TowerPlacement> layout;
+    int cost = 0;
+    int runs = 0;
+    int wins = 0;
+    int timeouts = 0;               // Runs cut off at maxSeconds (not in the stats below)
+    float winRate = 0.0f;           // Of the runs that finished
+    float meanHpLeft = 0.0f;
+    int minHpLeft = 0;
+    int medianHpLeft = 0;
+    int maxHpLeft = 0;
+    float meanWaveReached = 0.0f;
+};
+
+namespace BalanceRunner {
+    // Grid tiles where Map::CanPlaceTower allows a tower
+    std::vector<std::pair<int, int>> GetBuildableTiles(const Map& map);
+
+    // Random layout on distinct buildable tiles whose total cost fits the budget.
+    // With coverageMap set, tiles are drawn weighted by Map::GetPathCoverage.
+    std::vector<TowerPlacement> SampleLayout(
+        const std::vector<std::pair<int, int>>& tiles,
+        int budget,
+        std::mt19937& rng,
+        const Map* coverageMap = nullptr
+    );
+
+    // Sample and simulate all layouts in parallel. Empty result if the map fails to load.
+    std::vector<LayoutReport> Run(const BalanceConfig& config);
+
+    // Print reports best-first (win rate, then mean HP left)
+    void PrintReport(std::vector<LayoutReport> reports);
+
+    // Entry point for `--balance`; argv excludes the program name and flag
+    int RunFromCommandLine(int argc, char** argv);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "raylib.h"
+#include "core/FrameArena.h"
+#include "systems/EnemySystem.h"
+#include "systems/WaveSystem.h"
+#include "systems/TowerSystem.h"
+#include "map/Map.h"
+#include "tower/TowerTypes.h"
+
+// ============================================================
+// Simulation: Headless game simulation (no window, no UI)
+// ============================================================
+// Owns the same systems as Game and wires them the same way,
+// but never touches input, drawing or the UI. Waves start as
+// soon as the previous one is cleared. Each instance has its
+// own RNG seed, so many can run in parallel on worker threads.
+// ============================================================
+
+struct SimulationResult {
+    bool victory = false;     // All waves cleared with HP left
+    int hpLeft = 0;           // Base HP at the end of the run
+    int waveReached = 0;      // Last wave started
+    float simulatedTime = 0;  // Game seconds simulated
+    bool timedOut = false;    // RunToEnd hit maxSeconds with the run still undecided
+};
+
+class Simulation {
+public:
+    Simulation();
+
+    // Systems capture `this` in callbacks - never copy or move
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Build the map and reset all systems for a fresh run.
+    // mapFile == nullptr uses the default map; returns false if it can't load.
+    bool Init(unsigned int seed, const char* mapFile = nullptr);
+
+    // Place a tower on a grid tile (ignores gold; the caller owns the budget)
+    bool PlaceTower(TowerType type, int gridX, int gridY);
+
+    // Advance the simulation by one fixed step
+    void Step(float dt);
+
+    // Run until victory, defeat or maxSeconds of game time (then timedOut is set)
+    SimulationResult RunToEnd(float dt, float maxSeconds);
+
+    bool IsFinished() const { return defeated || waveSystem.IsVictory(); }
+    SimulationResult GetResult() const;
+
+    // Accessors
+    Map& GetMap() { return gameMap; }
+    const Map& GetMap() const { return gameMap; }
+    EnemySystem& GetEnemySystem() { return enemySystem; }
+    WaveSystem& GetWaveSystem() { return waveSystem; }
+    TowerSystem& GetTowerSystem() { return towerSystem; }
+
+    static constexpr int MAX_HP = 20;   // Same base HP as Game
+
+private:
+    void ConnectSystems();
+
+    Registry registry;
+    FrameArena frameArena;  // Reset at the end of every Step()
+    EventBus events;        // Dispatched at the end of every Step()
+    EnemySystem enemySystem;
+    WaveSystem waveSystem;
+    TowerSystem towerSystem;
+    Map gameMap;
+
+    int playerHP;
+    bool defeated;
+    float elapsed;
+};
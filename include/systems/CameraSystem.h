@@ -0,0 +1,52 @@
+#pragma once
+
+#include "raylib.h"
+
+// ============================================================
+// CameraSystem: Pan / zoom view over the world
+// ============================================================
+// The map, enemies and towers live in world space and are drawn
+// between BeginWorld() and EndWorld(); the HUD stays in screen
+// space. Mouse input meant for the world has to go through
+// ScreenToWorld() first.
+//
+// Controls: WASD / arrow keys or middle-mouse drag to pan, mouse
+// wheel to zoom around the cursor, HOME to reset the view.
+// The view centre is kept inside the world bounds.
+// ============================================================
+class CameraSystem {
+public:
+    CameraSystem();
+    
+    // Pan is limited to these bounds (typically Map::GetWorldBounds())
+    void SetWorldBounds(Rectangle bounds);
+    
+    // Zoom 1, world origin at the top-left of the screen
+    void Reset();
+    
+    // Called every frame by the game loop (reads input)
+    void Update(float dt);
+    
+    void BeginWorld() const;
+    void EndWorld() const;
+    
+    Vector2 ScreenToWorld(Vector2 screenPos) const;
+    Vector2 WorldToScreen(Vector2 worldPos) const;
+    
+    // World-space rectangle currently on screen (for culling)
+    Rectangle GetVisibleWorld() const;
+    
+    const Camera2D& GetCamera() const { return camera; }
+    float GetZoom() const { return camera.zoom; }
+    
+    static constexpr float PAN_SPEED = 600.0f;     // Screen pixels per second
+    static constexpr float ZOOM_STEP = 0.1f;       // Fraction per wheel notch
+    static constexpr float MIN_ZOOM = 0.1f;
+    static constexpr float MAX_ZOOM = 3.0f;
+    
+private:
+    void ClampToBounds();
+    
+    Camera2D camera;
+    Rectangle worldBounds;
+};
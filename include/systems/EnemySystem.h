@@ -6,34 +6,46 @@
 #include "raylib.h"
 #include "enemy/EnemyManager.h"
 #include "enemy/EnemyTypes.h"
+#include "core/GameEvents.h"
+
+class MemoryReport;
 
 // High-level wrapper that connects Enemy/EnemyManager to the core game loop.
 // Core should talk to EnemySystem, not directly to Enemy/EnemyManager.
 class EnemySystem
 {
 public:
+    // Enemies are stored as components on the given registry.
+    // Publishes EnemyKilled and EnemyReachedBase on the event bus.
+    EnemySystem(Registry& registry, EventBus& events);
+
+    // Enemies hold a pointer to enemyEvents - never copy or move
+    EnemySystem(const EnemySystem&) = delete;
+    EnemySystem& operator=(const EnemySystem&) = delete;
+
     // Called once per frame by the core.
     void Update(float dt);
 
-    // Called once per frame by the core.
-    void Draw();
+    // Called once per frame by the core (view: visible world rectangle).
+    void Draw(Rectangle view);
 
     // Provide the current waypoint path (from Map/Path system).
     void SetWaypoints(const std::vector<Vector2>& newWaypoints);
 
     // Spawn an enemy (Wave/Spawner will call this later; can be used for demo too).
-    void SpawnEnemy(EnemyType type, Vector2 startPos);
+    // hpMultiplier scales max HP (endless mode waves).
+    void SpawnEnemy(EnemyType type, Vector2 startPos, float hpMultiplier = 1.0f);
 
     // Core-facing queries:
     // True if at least one enemy reached the end in the current frame.
     bool HasEnemyReachedEnd() const;
 
+    // Number of enemies that reached the end in the current frame.
+    int GetReachedEndCount() const { return reachedEndThisFrame; }
+
     // True if there are no enemies alive (useful for wave completion).
     bool AreAllEnemiesDead() const;
 
-    // Optional: connect reward event to external money system.
-    void SetOnReward(std::function<void(int)> cb);
-
     // Clears enemies and resets internal flags.
     void Reset();
     
@@ -41,13 +53,19 @@ public:
     EnemyManager& GetManager() { return manager; }
     const EnemyManager& GetManager() const { return manager; }
 
+    // Enemies and the sampled path they walk
+    void ReportMemory(MemoryReport& report) const;
+
 private:
     EnemyManager manager;
     std::vector<Vector2> waypoints;
+    PathSamples pathSamples;     // Built from waypoints; the manager keeps a pointer to it
+
+    // Frame counter: enemies that reached the end this frame.
+    int reachedEndThisFrame = 0;
 
-    // Frame flag: set to true when an enemy reaches the end this frame.
-    bool reachedEndThisFrame = false;
+    EventBus& events;
 
-    // Reward callback (wired by external money system or demo).
-    std::function<void(int)> onReward;
+    // Shared by all spawned enemies; they point here instead of copying callbacks.
+    EnemyEvents enemyEvents;
 };
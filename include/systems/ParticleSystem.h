@@ -0,0 +1,84 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MemoryReport;
+
+// ============================================================
+// ParticleSystem: Pooled effect particles (hits, splashes, deaths)
+// ============================================================
+// Particles are structure-of-arrays with a fixed capacity, all
+// reserved up front: emitting and updating never allocate. Live
+// particles are packed at the front; a dead one is replaced by
+// the last live one, so the update runs over a dense range (four
+// at a time with SSE2 on x86) and the draw is one tight loop of
+// rectangles that raylib sends as a single batch.
+//
+// Budget: below SOFT_LIMIT live particles every emitter gets its
+// full count; between SOFT_LIMIT and MAX_PARTICLES counts shrink
+// linearly towards zero, and at MAX_PARTICLES new particles are
+// dropped. Heavy waves get fewer particles per effect, never a
+// slower frame.
+// ============================================================
+class ParticleSystem {
+public:
+    ParticleSystem();
+    
+    // Called every frame by the game loop (not while paused)
+    void Update(float dt);
+    void Draw(Rectangle view) const;    // view: visible world rectangle
+    void Clear();
+    
+    // Emitters
+    void EmitHit(Vector2 position, Color color);
+    void EmitSplash(Vector2 position, float radius, Color color);
+    void EmitDeath(Vector2 position, Color color);
+    
+    int GetCount() const { return static_cast<int>(count); }
+    size_t GetDroppedCount() const { return dropped; }   // Cut by the budget since Clear()
+    
+    void ReportMemory(MemoryReport& report) const;
+    
+    static constexpr size_t MAX_PARTICLES = 4096;
+    static constexpr size_t SOFT_LIMIT = 2048;
+    
+private:
+    struct Burst {
+        int count;
+        float minSpeed;
+        float maxSpeed;
+        float life;         // Seconds (randomized +-25%)
+        float size;         // Starting side length; shrinks to 0 over the life
+    };
+    
+    void Emit(Vector2 position, Color color, const Burst& burst, float ringRadius);
+    
+    // Requested particles allowed under the budget
+    size_t Allow(int requested);
+    
+    // Uniform in [0, 1) (xorshift; effects only, not game state)
+    float Random();
+    
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> life;        // Seconds left
+    std::vector<float> invLife;     // 1 / starting life (for fade)
+    std::vector<float> size;
+    std::vector<Color> color;
+    size_t count;
+    size_t dropped;
+    uint32_t rngState;
+    
+    static constexpr float DRAG = 3.0f;         // Velocity decay per second
+    static constexpr float BUOYANCY = 40.0f;    // Upward drift (px/s^2), we're underwater
+    
+    static constexpr Burst HIT_BURST = { 6, 40.0f, 120.0f, 0.25f, 4.0f };
+    static constexpr Burst SPLASH_BURST = { 28, 30.0f, 90.0f, 0.45f, 5.0f };
+    static constexpr Burst DEATH_BURST = { 14, 20.0f, 80.0f, 0.6f, 6.0f };
+};
@@ -3,24 +3,38 @@
 #include "raylib.h"
 #include "tower/TowerManager.h"
 #include "tower/TowerTypes.h"
+#include "core/GameEvents.h"
 #include "enemy/Enemy.h"
+#include "enemy/EnemyManager.h"
+#include "utils/SpatialGrid.h"
 
 #include <vector>
 #include <functional>
 
+class MemoryReport;
+
 // ============================================================
 // TowerSystem: High-level tower management for Game class
 // ============================================================
 // Handles tower placement, targeting, and damage dealing
+//
+// Targets are sticky: a tower keeps shooting the enemy it picked
+// while that enemy is alive and in range, and only scans again
+// when it dies (its entity handle goes stale), leaves range, or
+// after RESCAN_SHOTS shots so a policy-better enemy (one that
+// overtook it, or newly entered range) is picked up.
 // ============================================================
 
 class TowerSystem {
 public:
-    TowerSystem();
+    // Towers and projectiles are stored as components on the given registry.
+    // Publishes TowerSold on the event bus.
+    TowerSystem(Registry& registry, EventBus& events);
     
-    // Core methods called by Game
-    void Update(float dt, std::vector<Enemy>& enemies);
-    void Draw() const;
+    // Core methods called by Game. Enemy positions are resolved only if
+    // there are towers or projectiles to look at them.
+    void Update(float dt, EnemyManager& enemies);
+    void Draw(Rectangle view) const;     // view: visible world rectangle
     void Reset();
     
     // Tower placement (called by Game on player input)
@@ -32,12 +46,25 @@ public:
     void DeselectAll();
     Tower* GetSelectedTower() const;
     
+    // Upgrade / sell the selected tower (gold goes through the spend/refund callbacks)
+    bool TryUpgradeSelected();
+    bool SellSelected();
+    
+    // Switch the selected tower to its next targeting mode
+    bool CycleSelectedTargeting();
+    
     // Set valid placement callback
     void SetCanPlaceAt(std::function<bool(Vector2)> callback);
     
+    // Set path coverage query (precomputed by Map) for the placement preview
+    void SetPathCoverageQuery(std::function<float(Vector2, TowerType)> callback);
+    
     // Set callback for when gold should be spent
     void SetOnSpendGold(std::function<bool(int)> callback);
     
+    // Set allocator for per-tick scratch data (reset by the owner each tick)
+    void SetFrameAllocator(std::pmr::memory_resource* resource) { manager.SetFrameAllocator(resource); }
+    
     // Get tower cost for UI
     static int GetTowerCost(TowerType type);
     
@@ -45,6 +72,9 @@ public:
     TowerManager& GetManager() { return manager; }
     const TowerManager& GetManager() const { return manager; }
     
+    // Towers, projectiles and the targeting snapshot of enemy positions
+    void ReportMemory(MemoryReport& report) const;
+    
     // Current selected tower type for placement
     void SetSelectedTowerType(TowerType type) { selectedType = type; }
     TowerType GetSelectedTowerType() const { return selectedType; }
@@ -55,11 +85,15 @@ public:
     void DrawPreview() const;
     
 private:
-    // Find best target for a tower
+    // Keep the tower's sticky target if still valid, otherwise FindTarget()
+    Enemy* AcquireTarget(Tower& tower, std::vector<Enemy>& enemies);
+    
+    // Find best target for a tower (full scan of enemies in range)
     Enemy* FindTarget(Tower& tower, std::vector<Enemy>& enemies);
     
     // Apply damage to enemies
-    void HandleProjectileHit(Projectile& proj, Vector2 hitPos, std::vector<Enemy>& enemies);
+    // sweepStart..hitPos is the flight covered in this update (swept single-target hit)
+    void HandleProjectileHit(Projectile& proj, Vector2 sweepStart, Vector2 hitPos, std::vector<Enemy>& enemies);
     
     TowerManager manager;
     
@@ -69,8 +103,33 @@ private:
     bool previewActive;
     
     std::function<bool(Vector2)> canPlaceAt;
+    std::function<float(Vector2, TowerType)> pathCoverageAt;
     std::function<bool(int)> onSpendGold;
     
     // Cache for enemy targeting
-    std::vector<Enemy>* currentEnemies;
+    EnemyManager* currentEnemies;       // Set during Update (hit callback, slows)
+    ComponentPool<Enemy>& enemyPool;    // Resolves towers' sticky target handles
+    
+    // Stretches of path any tower can reach (range plus splash / hit radius);
+    // only enemies walking there are resolved for targeting and hits
+    void UpdateTowerCoverage(const EnemyManager& enemyManager);
+    PathRanges towerCoverage;
+    uint32_t coverageLayoutVersion;
+    uint32_t coveragePathVersion;
+    bool coverageShrinkPending;     // Kept a removed tower's stretch for projectiles in flight
+    
+    // Positions of the resolved enemies as SoA for the batch range queries (snapshot per Update)
+    void SnapshotEnemyPositions(const EnemyManager& enemyManager);
+    void RemapHits(size_t count);   // queryHits: snapshot indices -> GetEnemies() indices
+    std::vector<float> enemyX;
+    std::vector<float> enemyY;
+    std::vector<int> enemyIndex;  // GetEnemies() index of each snapshot entry
+    std::vector<int> queryHits;   // Indices returned by enemyGrid queries
+    SpatialGrid enemyGrid;        // Over enemyX / enemyY, for segment queries
+    
+    static constexpr size_t INITIAL_ENEMY_CAPACITY = 512;
+    static constexpr float SINGLE_HIT_RADIUS = 30.0f;   // Max distance for a single-target hit
+    static constexpr int RESCAN_SHOTS = 3;              // Shots at a sticky target before re-checking the policy
+    
+    EventBus& events;
 };
@@ -2,7 +2,8 @@
 
 #include "raylib.h"
 #include "core/GameConfig.h"
-#include <string>
+
+class MemoryReport;
 
 // UI katmanının sorumlulukları:
 // - HUD çizimi (HP, Para, Dalga)
@@ -25,9 +26,12 @@ struct HUDData {
 	int totalWaves = 0;
 };
 
+// Satırlar sabit boyutlu tamponlarda tutulur; mesaj göstermek heap'e dokunmaz.
 struct StoryBanner {
-	std::string line1;
-	std::string line2;
+	static constexpr int LINE_CAPACITY = 128;
+
+	char line1[LINE_CAPACITY] = {};
+	char line2[LINE_CAPACITY] = {};
 	float timer = 0.0f;
 	float duration = 0.0f;
 	bool active = false;
@@ -46,11 +50,14 @@ public:
 	void Update(float dt);
 
 	// Kısa hikaye / uyarı mesajı göster.
-	void ShowStory(const std::string& line1, const std::string& line2, float durationSeconds);
+	void ShowStory(const char* line1, const char* line2, float durationSeconds);
 
 	// Her frame en sonda çağrılmalı; uygun UI ekranını çizer.
 	void Draw();
 
+	// Bellek raporu: "UI strings" (hikaye satırları) ve "Fonts" (yüklü UI fontu).
+	void ReportMemory(MemoryReport& report) const;
+
 private:
 	void DrawStoryBanner();
 
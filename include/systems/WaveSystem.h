@@ -12,7 +12,7 @@
 class WaveSystem
 {
 public:
-    WaveSystem() = default;
+    explicit WaveSystem(EventBus& events) : waveManager(events) {}
     
     // Called every frame by the game loop
     void Update(float dt);
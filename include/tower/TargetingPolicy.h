@@ -0,0 +1,74 @@
+#pragma once
+
+#include "raylib.h"
+#include "TowerTypes.h"
+#include "enemy/Enemy.h"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// ============================================================
+// Targeting policies
+// ============================================================
+// One struct per TargetingMode with a static Score(); the enemy
+// with the highest score wins. SelectTarget<Policy> is stamped out
+// per policy, so each mode is its own loop with the score inlined:
+// no virtual call or mode switch per enemy. The mode is resolved
+// once per query by the SelectTarget(TargetingMode, ...) overload.
+// ============================================================
+namespace Targeting {
+
+// Progress is the enemy's distance along the path
+struct First {
+    static float Score(const Enemy& enemy, float) { return enemy.distance; }
+};
+
+struct Last {
+    static float Score(const Enemy& enemy, float) { return -enemy.distance; }
+};
+
+struct Strongest {
+    static float Score(const Enemy& enemy, float) { return enemy.hp; }
+};
+
+struct Weakest {
+    static float Score(const Enemy& enemy, float) { return -enemy.hp; }
+};
+
+struct Closest {
+    static float Score(const Enemy&, float distSq) { return -distSq; }
+};
+
+struct Fastest {
+    static float Score(const Enemy& enemy, float) { return enemy.speed; }
+};
+
+// Best living enemy among enemies[candidates[0..count)]; nullptr if none
+template <typename Policy>
+Enemy* SelectTarget(Vector2 towerPos, std::vector<Enemy>& enemies,
+                    const int* candidates, size_t count)
+{
+    Enemy* best = nullptr;
+    float bestScore = -std::numeric_limits<float>::max();
+    
+    for (size_t i = 0; i < count; ++i) {
+        Enemy& enemy = enemies[candidates[i]];
+        if (!enemy.alive) continue;
+        
+        float dx = enemy.position.x - towerPos.x;
+        float dy = enemy.position.y - towerPos.y;
+        float score = Policy::Score(enemy, dx * dx + dy * dy);
+        if (score > bestScore) {
+            bestScore = score;
+            best = &enemy;
+        }
+    }
+    return best;
+}
+
+// Runtime mode -> the matching SelectTarget<Policy> (TargetingPolicy.cpp)
+Enemy* SelectTarget(TargetingMode mode, Vector2 towerPos, std::vector<Enemy>& enemies,
+                    const int* candidates, size_t count);
+
+} // namespace Targeting
@@ -2,6 +2,8 @@
 
 #include "raylib.h"
 #include "TowerTypes.h"
+#include "core/Registry.h"
+#include <cstdint>
 #include <functional>
 
 // Forward declaration
@@ -10,9 +12,19 @@ struct Enemy;
 // ============================================================
 // Projectile: Visual representation of tower attacks
 // ============================================================
+// Flies in a straight line from position (the launch point) to
+// targetPos at constant speed. TowerManager schedules the impact
+// when it is fired; the in-flight position is only worked out
+// for drawing (see TowerManager::GetProjectilePosition).
+// ============================================================
 struct Projectile {
-    Vector2 position;
+    Vector2 position;       // Launch point
     Vector2 targetPos;
+    Vector2 velocity;       // Set when scheduled
+    double launchTime;      // TowerManager clock at launch
+    float flightTime;       // Seconds until impact
+    uint32_t impactTick;    // Impact wheel tick the hit lands on
+    Entity nextImpact;      // Next projectile in the same wheel slot
     float speed;
     float damage;
     float splashRadius;
@@ -24,6 +36,11 @@ struct Projectile {
     Projectile()
         : position{0, 0}
         , targetPos{0, 0}
+        , velocity{0, 0}
+        , launchTime(0.0)
+        , flightTime(0.0f)
+        , impactTick(0)
+        , nextImpact{}
         , speed(400.0f)
         , damage(0.0f)
         , splashRadius(0.0f)
@@ -42,34 +59,48 @@ public:
     Tower();
     Tower(TowerType type, Vector2 position);
     
-    // Core update - handles cooldown
-    void Update(float dt);
-    
     // Check if enemy is in range
     bool IsInRange(Vector2 enemyPos) const;
     
     // Get distance to a position
     float GetDistanceTo(Vector2 pos) const;
     
-    // Check if ready to fire
-    bool CanFire() const;
-    
-    // Fire at target position, returns projectile
+    // Fire at target position, returns projectile. The cooldown until the
+    // next shot (GetCooldownTime) is scheduled by TowerManager.
     Projectile Fire(Vector2 targetPos);
     
-    // Drawing
-    void Draw() const;
+    // Upgrades (applied in place; the tower object is never reallocated)
+    bool CanUpgrade() const { return level + 1 < TOWER_MAX_LEVEL; }
+    int GetUpgradeCost() const;     // 0 if already at max level
+    bool Upgrade();                 // Apply next level's stats; false at max level
+    int GetSellValue() const;       // Refund for selling (share of gold invested)
+    
+    // Targeting mode (player-selectable; default FIRST)
+    TargetingMode GetTargetingMode() const { return targeting; }
+    void SetTargetingMode(TargetingMode mode) { targeting = mode; ClearTarget(); }
+    void CycleTargetingMode() { SetTargetingMode(NextTargetingMode(targeting)); }
+    
+    // Sticky target: the enemy entity picked by the last scan (see TowerSystem)
+    Entity GetTarget() const { return target; }
+    void SetTarget(Entity enemy) { target = enemy; shotsAtTarget = 0; }
+    void ClearTarget() { SetTarget(Entity{}); }
+    int GetShotsAtTarget() const { return shotsAtTarget; }
+    
+    // Drawing (cooldownLeft in seconds, for the cooldown indicator)
+    void Draw(float cooldownLeft = 0.0f) const;
     void DrawRange() const;
     
     // Getters
     TowerType GetType() const { return type; }
     Vector2 GetPosition() const { return position; }
     float GetRange() const { return stats.range; }
+    float GetCooldownTime() const { return cooldownTime; }
     float GetDamage() const { return stats.damage; }
     float GetSplashRadius() const { return stats.splashRadius; }
     float GetSlowAmount() const { return stats.slowAmount; }
     float GetSlowDuration() const { return stats.slowDuration; }
-    int GetCost() const { return stats.cost; }
+    int GetLevel() const { return level; }
+    int GetInvestedGold() const { return investedGold; }
     const TowerStats& GetStats() const { return stats; }
     
     // Selection state for UI
@@ -80,8 +111,12 @@ private:
     TowerType type;
     Vector2 position;
     TowerStats stats;
+    int level;              // Upgrade level (0 = as built)
+    int investedGold;       // Build cost plus all upgrades, for sell refunds
+    TargetingMode targeting;
+    Entity target;          // Current target (may be stale; validate before use)
+    int shotsAtTarget;      // Shots fired since target was picked
     
-    float fireCooldown;     // Current cooldown timer
     float cooldownTime;     // Time between shots (1/fireRate)
     
     bool selected;          // For UI highlighting
@@ -1,19 +1,45 @@
 #pragma once
 
 #include "Tower.h"
+#include "core/Registry.h"
+#include "core/TimingWheel.h"
 #include <vector>
 #include <functional>
+#include <memory_resource>
+
+class MemoryReport;
 
 // ============================================================
 // TowerManager: Manages all towers and projectiles
 // ============================================================
+// Towers and projectiles are Tower / Projectile components on
+// the shared Registry. The selected tower is held by entity
+// handle, so removing other towers can never leave it dangling.
+//
+// Projectiles fly in straight lines at constant speed, so their
+// impact tick is known when they are fired. Each one is linked
+// into a timing wheel slot (tick % IMPACT_WHEEL_SLOTS) and the
+// update only visits the slots of ticks that have passed: a
+// projectile costs O(1) simulation work however long it flies.
+// Flights longer than the wheel stay in their slot until their
+// tick comes round.
+//
+// Tower cooldowns work the same way: firing schedules the tower's
+// ready tick on a TimingWheel, and only towers whose cooldown has
+// run out are in the ready list that TowerSystem visits. Towers
+// that are ready but have nothing to shoot stay in the list.
+//
+// A hit reports the stretch of flight covered during the update
+// it landed in (sweepStart to targetPos), so the receiver can do
+// swept collision that stays correct whatever dt is.
+// ============================================================
 class TowerManager {
 public:
-    TowerManager();
+    explicit TowerManager(Registry& registry);
     
     // Core methods
-    void Update(float dt);
-    void Draw() const;
+    void Update(float dt);      // Advance the clock, cooldowns and projectiles
+    void Draw(Rectangle view) const;     // Skips towers/projectiles outside view
     void DrawRanges() const;
     void Clear();
     
@@ -22,37 +48,97 @@ public:
     bool RemoveTower(Vector2 position);
     Tower* GetTowerAt(Vector2 position, float tolerance = 30.0f);
     
+    // Ready towers: fn(Tower&) returns true if the tower fired, which starts its
+    // cooldown. A tower with nothing to shoot is parked for IDLE_RETRY_TICKS
+    // instead of being asked again every tick.
+    template <typename Fn>
+    void ForEachReadyTower(Fn&& fn) {
+        for (size_t i = 0; i < readyTowers.size(); ++i) {
+            Entity entity = readyTowers[i];
+            Tower* tower = towers.TryGet(entity);
+            if (!tower) continue;
+            
+            if (fn(*tower)) {
+                StartCooldown(entity, *tower);
+            } else {
+                idleTowers.Schedule(entity, currentTick + IDLE_RETRY_TICKS);
+            }
+        }
+        readyTowers.clear();
+    }
+    int GetReadyTowerCount() const { return static_cast<int>(readyTowers.size()); }
+    
+    // Cap a pending cooldown to the tower's (new, shorter) cooldown time
+    void OnTowerUpgraded(Tower* tower);
+    
     // Selection
     void SelectTower(Tower* tower);
     void DeselectAll();
-    Tower* GetSelectedTower() const { return selectedTower; }
+    Tower* GetSelectedTower() const { return registry.TryGet<Tower>(selectedTower); }
     
     // Projectile management
     void AddProjectile(const Projectile& proj);
-    void UpdateProjectiles(float dt);
-    void DrawProjectiles() const;
+    void UpdateProjectiles();
+    void DrawProjectiles(Rectangle view) const;
+    Vector2 GetProjectilePosition(const Projectile& proj) const;
+    
+    // "Towers" (pool, cooldown wheel) and "Projectiles" (pool, impact wheel)
+    void ReportMemory(MemoryReport& report) const;
     
-    // Get all towers (for targeting)
-    std::vector<Tower>& GetTowers() { return towers; }
-    const std::vector<Tower>& GetTowers() const { return towers; }
+    // Get all towers (for targeting; dense component array)
+    std::vector<Tower>& GetTowers() { return towers.Components(); }
+    const std::vector<Tower>& GetTowers() const { return towers.Components(); }
     
-    // Get active projectiles (for hit detection)
-    std::vector<Projectile>& GetProjectiles() { return projectiles; }
-    const std::vector<Projectile>& GetProjectiles() const { return projectiles; }
+    // Get active projectiles (for hit detection; dense component array)
+    std::vector<Projectile>& GetProjectiles() { return projectiles.Components(); }
+    const std::vector<Projectile>& GetProjectiles() const { return projectiles.Components(); }
     
     // Callbacks
-    void SetOnProjectileHit(std::function<void(Projectile&, Vector2)> callback);
+    void SetOnProjectileHit(std::function<void(Projectile&, Vector2 sweepStart, Vector2 hitPos)> callback);
+
+    // Allocator for per-tick scratch lists (typically the owner's FrameArena)
+    void SetFrameAllocator(std::pmr::memory_resource* resource);
     
     // Queries
-    int GetTowerCount() const { return static_cast<int>(towers.size()); }
+    int GetTowerCount() const { return static_cast<int>(towers.Size()); }
+    int GetProjectileCount() const { return static_cast<int>(projectiles.Size()); }
+    
+    // Changes whenever a tower is placed, removed or upgraded (range may change)
+    uint32_t GetLayoutVersion() const { return layoutVersion; }
     bool HasTowerAt(Vector2 position, float tolerance = 30.0f) const;
     
 private:
-    std::vector<Tower> towers;
-    std::vector<Projectile> projectiles;
-    Tower* selectedTower;
+    Registry& registry;
+    ComponentPool<Tower>& towers;
+    ComponentPool<Projectile>& projectiles;
+    Entity selectedTower;
+    std::pmr::memory_resource* frameAllocator;
+    
+    std::function<void(Projectile&, Vector2, Vector2)> onProjectileHit;
+    
+    // Clock shared by cooldowns and projectiles, in TimingWheel::TICK steps
+    double clock;               // Seconds since Clear()
+    double previousClock;       // clock before the current Update
+    uint32_t currentTick;
+    
+    // Tower cooldowns
+    void StartCooldown(Entity entity, const Tower& tower);
+    TimingWheel cooldowns;
+    TimingWheel idleTowers;     // Ready but had no target: retried after IDLE_RETRY_TICKS
+    std::vector<Entity> readyTowers;
+    
+    // Impact timing wheel (intrusive lists through Projectile::nextImpact)
+    void ScheduleImpact(Entity entity, Projectile& proj);
+    std::vector<Entity> impactWheel;
+    uint32_t processedTick;     // Last wheel tick whose impacts were delivered
     
-    std::function<void(Projectile&, Vector2)> onProjectileHit;
+    uint32_t layoutVersion;
     
-    static constexpr float PROJECTILE_HIT_RADIUS = 10.0f;
+    static constexpr float TOWER_DRAW_MARGIN = 40.0f;       // Tower radius plus barrel / level pips
+    static constexpr float PROJECTILE_DRAW_MARGIN = 20.0f;  // Projectile plus trail
+    static constexpr float PROJECTILE_HIT_RADIUS = 10.0f;   // Hit lands this far short of targetPos
+    static constexpr uint32_t IDLE_RETRY_TICKS = 5;         // ~83 ms before an idle tower looks again
+    static constexpr uint32_t IMPACT_WHEEL_SLOTS = 256;     // Power of two; ~4.3 s of ticks
+    static constexpr size_t INITIAL_TOWER_CAPACITY = 128;
+    static constexpr size_t INITIAL_PROJECTILE_CAPACITY = 512;
 };
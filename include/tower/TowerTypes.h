@@ -11,9 +11,14 @@
 enum class TowerType {
     CORAL_CANNON,       // Single target, high damage
     TIDAL_BURST,        // AoE splash damage
-    FROST_TOTEM         // Slow effect, low/no damage
+    FROST_TOTEM,        // Slow effect, low/no damage
+    
+    COUNT               // Number of tower types (not a real type)
 };
 
+// Number of tower types (for per-type tables)
+constexpr int TOWER_TYPE_COUNT = static_cast<int>(TowerType::COUNT);
+
 // Tower stat configuration
 struct TowerStats {
     int cost;               // Gold cost to build
@@ -25,7 +30,7 @@ struct TowerStats {
     float slowDuration;     // How long slow lasts
     float projectileSpeed;  // Speed of projectile (0 for instant)
     
-    TowerStats()
+    constexpr TowerStats()
         : cost(50)
         , damage(25.0f)
         , range(150.0f)
@@ -35,54 +40,113 @@ struct TowerStats {
         , slowDuration(0.0f)
         , projectileSpeed(400.0f)
     {}
+    
+    constexpr TowerStats(int cost, float damage, float range, float fireRate,
+                         float splashRadius, float slowAmount, float slowDuration,
+                         float projectileSpeed)
+        : cost(cost)
+        , damage(damage)
+        , range(range)
+        , fireRate(fireRate)
+        , splashRadius(splashRadius)
+        , slowAmount(slowAmount)
+        , slowDuration(slowDuration)
+        , projectileSpeed(projectileSpeed)
+    {}
 };
 
-// Get default stats for each tower type
-inline TowerStats GetTowerStats(TowerType type) {
-    TowerStats stats;
-    
-    switch (type) {
-        case TowerType::CORAL_CANNON:
-            stats.cost = 50;
-            stats.damage = 35.0f;
-            stats.range = 150.0f;
-            stats.fireRate = 1.2f;
-            stats.splashRadius = 0.0f;
-            stats.slowAmount = 0.0f;
-            stats.projectileSpeed = 500.0f;
-            break;
-            
-        case TowerType::TIDAL_BURST:
-            stats.cost = 75;
-            stats.damage = 20.0f;
-            stats.range = 120.0f;
-            stats.fireRate = 0.8f;
-            stats.splashRadius = 60.0f;
-            stats.slowAmount = 0.0f;
-            stats.projectileSpeed = 350.0f;
-            break;
-            
-        case TowerType::FROST_TOTEM:
-            stats.cost = 60;
-            stats.damage = 5.0f;
-            stats.range = 130.0f;
-            stats.fireRate = 1.5f;
-            stats.splashRadius = 0.0f;
-            stats.slowAmount = 0.4f;      // 40% slow
-            stats.slowDuration = 2.0f;    // 2 seconds
-            stats.projectileSpeed = 600.0f;
-            break;
+// Upgrade levels per tower (level 0 = freshly built)
+constexpr int TOWER_MAX_LEVEL = 3;
+
+// Fraction of all gold invested in a tower returned when it is sold
+constexpr float TOWER_SELL_REFUND = 0.7f;
+
+// One row per TowerType, in enum order.
+// levels[0] is the built tower; levels[n].cost is the price of upgrading to level n.
+struct TowerTypeInfo {
+    TowerType type;
+    const char* name;
+    TowerStats levels[TOWER_MAX_LEVEL];
+};
+
+// ============================================================
+// Tower stat table (indexed by TowerType, then level)
+// ============================================================
+inline constexpr TowerTypeInfo TOWER_TYPES[] = {
+    //  cost  damage  range  rate  splash  slow  slowDur  projSpeed
+    { TowerType::CORAL_CANNON, "Coral Cannon", {
+        {  50,  35.0f, 150.0f, 1.2f,  0.0f, 0.0f,   0.0f,    500.0f },
+        {  60,  60.0f, 165.0f, 1.3f,  0.0f, 0.0f,   0.0f,    550.0f },
+        { 100, 100.0f, 180.0f, 1.5f,  0.0f, 0.0f,   0.0f,    600.0f },
+    } },
+    { TowerType::TIDAL_BURST, "Tidal Burst", {
+        {  75,  20.0f, 120.0f, 0.8f, 60.0f, 0.0f,   0.0f,    350.0f },
+        {  80,  32.0f, 130.0f, 0.9f, 70.0f, 0.0f,   0.0f,    375.0f },
+        { 120,  50.0f, 140.0f, 1.0f, 80.0f, 0.0f,   0.0f,    400.0f },
+    } },
+    { TowerType::FROST_TOTEM, "Frost Totem", {
+        {  60,   5.0f, 130.0f, 1.5f,  0.0f, 0.4f,   2.0f,    600.0f },
+        {  70,   8.0f, 140.0f, 1.7f,  0.0f, 0.5f,   2.5f,    650.0f },
+        { 100,  12.0f, 150.0f, 1.9f,  0.0f, 0.6f,   3.0f,    700.0f },
+    } },
+};
+
+constexpr bool ValidateTowerTypes() {
+    for (int i = 0; i < TOWER_TYPE_COUNT; ++i) {
+        const TowerTypeInfo& info = TOWER_TYPES[i];
+        if (static_cast<int>(info.type) != i) return false;
+        for (int level = 0; level < TOWER_MAX_LEVEL; ++level) {
+            const TowerStats& s = info.levels[level];
+            if (s.cost <= 0 || s.range <= 0.0f || s.fireRate <= 0.0f || s.projectileSpeed <= 0.0f) return false;
+            if (s.damage < 0.0f || s.splashRadius < 0.0f) return false;
+            if (s.slowAmount < 0.0f || s.slowAmount >= 1.0f || s.slowDuration < 0.0f) return false;
+        }
     }
-    
-    return stats;
+    return true;
+}
+
+static_assert(sizeof(TOWER_TYPES) / sizeof(TOWER_TYPES[0]) == TOWER_TYPE_COUNT,
+              "TOWER_TYPES needs exactly one row per TowerType");
+static_assert(ValidateTowerTypes(),
+              "TOWER_TYPES rows must be in enum order with positive cost/range/rate/speed at every level");
+
+// Get stats for a tower type at an upgrade level (default: as built)
+constexpr const TowerStats& GetTowerStats(TowerType type, int level = 0) {
+    return TOWER_TYPES[static_cast<int>(type)].levels[level];
 }
 
 // Get tower name for UI
-inline const char* GetTowerName(TowerType type) {
-    switch (type) {
-        case TowerType::CORAL_CANNON: return "Coral Cannon";
-        case TowerType::TIDAL_BURST: return "Tidal Burst";
-        case TowerType::FROST_TOTEM: return "Frost Totem";
-        default: return "Unknown";
-    }
+constexpr const char* GetTowerName(TowerType type) {
+    return TOWER_TYPES[static_cast<int>(type)].name;
+}
+
+// ============================================================
+// Targeting modes - which enemy in range a tower shoots at
+// ============================================================
+// Each mode has a compile-time policy in tower/TargetingPolicy.h.
+// ============================================================
+enum class TargetingMode {
+    FIRST,              // Furthest along the path
+    LAST,               // Least far along the path
+    STRONGEST,          // Most HP left
+    WEAKEST,            // Least HP left
+    CLOSEST,            // Nearest to the tower
+    FASTEST,            // Highest current speed
+    
+    COUNT               // Number of modes (not a real mode)
+};
+
+constexpr int TARGETING_MODE_COUNT = static_cast<int>(TargetingMode::COUNT);
+
+// Get targeting mode name for UI
+constexpr const char* GetTargetingModeName(TargetingMode mode) {
+    constexpr const char* NAMES[] = { "First", "Last", "Strongest", "Weakest", "Closest", "Fastest" };
+    static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == TARGETING_MODE_COUNT,
+                  "Need exactly one name per TargetingMode");
+    return NAMES[static_cast<int>(mode)];
+}
+
+// Next mode in UI cycling order (wraps around)
+constexpr TargetingMode NextTargetingMode(TargetingMode mode) {
+    return static_cast<TargetingMode>((static_cast<int>(mode) + 1) % TARGETING_MODE_COUNT);
 }
@@ -2,6 +2,7 @@
 
 #include "raylib.h"
 #include <cmath>
+#include <cstddef>
 
 // ============================================================
 // Math Utilities
@@ -110,4 +111,29 @@ inline bool CirclesOverlap(Vector2 c1, float r1, Vector2 c2, float r2) {
     return DistanceSquared(c1, c2) <= radiiSum * radiiSum;
 }
 
+// Squared distance from point to segment ab; t (0..1) is where along ab the closest point lies
+inline float SegmentDistanceSquared(Vector2 point, Vector2 a, Vector2 b, float* t = nullptr) {
+    Vector2 ab = {b.x - a.x, b.y - a.y};
+    float lenSq = LengthSquared(ab);
+    float s = lenSq > 0.0f ? Clamp(Dot({point.x - a.x, point.y - a.y}, ab) / lenSq, 0.0f, 1.0f) : 0.0f;
+    if (t) *t = s;
+    return DistanceSquared(point, {a.x + ab.x * s, a.y + ab.y * s});
+}
+
+// Centripetal Catmull-Rom: point at t (0..1) on the curve from p1 to p2, with
+// p0 and p3 as the neighbouring control points. Passes through p1 and p2 and
+// never loops or overshoots on sharp corners (Math.cpp).
+Vector2 CatmullRom(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, float t);
+
+// Batch queries over structure-of-arrays positions (Math.cpp).
+// Squared distances only; SIMD on x86 (AVX2 when the CPU has it, else SSE2).
+
+// Write the indices i with (xs[i], ys[i]) within radius of center to outIndices
+// (ascending; room for `count` entries). Returns how many were written.
+size_t PointsInRadius(Vector2 center, float radius,
+                      const float* xs, const float* ys, size_t count, int* outIndices);
+
+// True if this CPU (and OS) can run AVX2 code
+bool CpuHasAVX2();
+
 } // namespace MathUtils
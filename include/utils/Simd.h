@@ -0,0 +1,22 @@
+#pragma once
+
+// ============================================================
+// SIMD: x86 detection shared by the vector kernels
+// ============================================================
+// GOTD_SIMD_X86 is defined on x86 builds, which always have SSE2
+// (x86-64, or 32-bit MSVC with /arch:SSE2 and up). AVX2 kernels
+// are compiled into the same build with GOTD_TARGET_AVX2 and are
+// only called after MathUtils::CpuHasAVX2() says so, so the game
+// doesn't need to be built with /arch:AVX2 (or -mavx2).
+// ============================================================
+
+#if defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define GOTD_SIMD_X86
+#define GOTD_TARGET_AVX2
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__SSE2__))
+#define GOTD_SIMD_X86
+#define GOTD_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <cstddef>
+#include <vector>
+
+// ============================================================
+// SpatialGrid: Uniform grid over a structure-of-arrays point set
+// ============================================================
+// Build() buckets the points by cell with a counting sort, so the
+// grid is a few flat arrays and rebuilding it each tick is O(n).
+// Coordinates are copied in cell order too: the cells of one grid
+// row are contiguous, so QueryRadius tests each row's span with the
+// SIMD MathUtils::PointsInRadius kernel.
+// The grid covers the points' bounding box with cells of the given
+// size; a box wider than MAX_CELLS_PER_AXIS cells gets bigger cells
+// for that Build(), so the table stays bounded and every point still
+// lands in its own cell. The point arrays are not copied and must
+// stay valid until the next Build().
+// Storage is reserved up front, so rebuilding does not allocate
+// while the point count stays within the reserve.
+// ============================================================
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 64.0f);
+    
+    void Reserve(size_t points);
+    void Build(const float* xs, const float* ys, size_t count);
+    
+    // Write the indices of points within radius of segment ab to outIndices
+    // (room for the Build() count; any order). Returns how many were written.
+    size_t QuerySegment(Vector2 a, Vector2 b, float radius, int* outIndices) const;
+    
+    // Write the indices of up to maxResults points within radius of center
+    // (the first found, not the nearest). Returns how many were written.
+    size_t QueryRadius(Vector2 center, float radius, int* outIndices, size_t maxResults) const;
+    
+    // Heap bytes held by the cell and point tables
+    size_t MemoryBytes() const;
+    
+    static constexpr int MAX_CELLS_PER_AXIS = 64;
+    
+private:
+    int CellX(float x) const;
+    int CellY(float y) const;
+    
+    float baseCellSize;             // Smallest cell; Build() may grow cellSize past it
+    float cellSize;
+    float invCellSize;
+    float originX;
+    float originY;
+    int cols;
+    int rows;
+    
+    const float* pointX;
+    const float* pointY;
+    std::vector<int> cellStart;     // cols * rows + 1 offsets into cellPoints
+    std::vector<int> cellPoints;    // Point indices grouped by cell
+    std::vector<float> cellX;       // Point coordinates in cellPoints order
+    std::vector<float> cellY;
+    std::vector<int> pointCell;     // Cell of each point (Build scratch)
+    mutable std::vector<int> rowHits;   // QueryRadius scratch: hits within one row span
+};
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <functional>
+#include "core/GameEvents.h"
 
 // ============================================================
 // EconomySystem: Manages game resources (Gold/Energy)
@@ -9,11 +9,13 @@
 // - Starting resources
 // - Rewards from killing enemies
 // - Costs for building/upgrading towers
+//
+// Publishes GoldChanged and InsufficientFunds on the event bus.
 // ============================================================
 
 class EconomySystem {
 public:
-    EconomySystem();
+    explicit EconomySystem(EventBus& events);
     
     // -------------------- Initialization --------------------
     
@@ -40,14 +42,6 @@ public:
     int GetTotalEarned() const { return totalEarned; }
     int GetTotalSpent() const { return totalSpent; }
     
-    // -------------------- Callbacks --------------------
-    
-    // Called when gold amount changes (for UI updates)
-    void SetOnGoldChanged(std::function<void(int)> callback);
-    
-    // Called when a purchase fails due to insufficient funds
-    void SetOnInsufficientFunds(std::function<void(int cost, int available)> callback);
-    
     // -------------------- Wave Bonuses --------------------
     
     // Award bonus gold for completing a wave
@@ -62,9 +56,7 @@ private:
     int totalSpent;        // Total gold spent (statistics)
     int startingAmount;    // Initial gold value (for reset)
     
-    // Callbacks
-    std::function<void(int)> onGoldChanged;
-    std::function<void(int, int)> onInsufficientFunds;
+    EventBus& events;
     
     // Constants
     static constexpr int WAVE_COMPLETION_BASE_BONUS = 25;    // Base bonus per wave
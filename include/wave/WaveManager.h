@@ -3,9 +3,12 @@
 #include "raylib.h"
 #include "enemy/EnemyTypes.h"
 #include "EconomySystem.h"
+#include "core/GameEvents.h"
 
 #include <vector>
-#include <functional>
+#include <random>
+
+class MemoryReport;
 
 // ============================================================
 // WaveData: Defines the structure of a single wave
@@ -17,6 +20,7 @@ struct WaveData {
     EnemyType secondaryType;  // Secondary enemy type (optional mixing)
     float secondaryRatio;     // Ratio of secondary type (0.0 - 1.0)
     bool isBossWave;          // True if this is the final boss wave
+    float hpMultiplier;       // Scales enemy max HP (endless mode)
     
     WaveData()
         : enemyCount(5)
@@ -25,20 +29,36 @@ struct WaveData {
         , secondaryType(EnemyType::NORMAL)
         , secondaryRatio(0.0f)
         , isBossWave(false)
+        , hpMultiplier(1.0f)
     {}
     
     WaveData(int count, float interval, EnemyType primary, 
              EnemyType secondary = EnemyType::NORMAL, 
-             float secRatio = 0.0f, bool boss = false)
+             float secRatio = 0.0f, bool boss = false,
+             float hpMult = 1.0f)
         : enemyCount(count)
         , spawnInterval(interval)
         , primaryType(primary)
         , secondaryType(secondary)
         , secondaryRatio(secRatio)
         , isBossWave(boss)
+        , hpMultiplier(hpMult)
     {}
 };
 
+// ============================================================
+// WaveRecord: Per-wave statistics (wave reached, sim cost)
+// ============================================================
+struct WaveRecord {
+    int wave = 0;                 // Wave number (1-indexed)
+    int enemyCount = 0;           // Enemies scheduled for this wave
+    float hpMultiplier = 1.0f;    // HP scaling used for this wave
+    int peakActiveEnemies = 0;    // Most enemies alive at once
+    int frames = 0;               // Frames simulated while this wave was current
+    double simSeconds = 0.0;      // Wall time spent in simulation updates
+    double drawSeconds = 0.0;     // Wall time spent rendering
+};
+
 // ============================================================
 // WaveState: Current state of wave progression
 // ============================================================
@@ -53,9 +73,12 @@ enum class WaveState {
 // ============================================================
 // WaveManager: Manages wave progression, spawning, and economy
 // ============================================================
+// Publishes EnemySpawnRequested, WaveCleared, BossWarning and
+// AllWavesCompleted on the event bus.
+// ============================================================
 class WaveManager {
 public:
-    WaveManager();
+    explicit WaveManager(EventBus& events);
     
     // -------------------- Core Methods --------------------
     
@@ -77,31 +100,42 @@ public:
     // Force start (for testing/debug)
     void ForceStartWave(int waveIndex);
     
-    // -------------------- Spawn Configuration --------------------
+    // Seed the wave composition RNG (headless runs use one seed per run)
+    void SetSeed(unsigned int seed) { rng.seed(seed); }
     
-    // Set the spawn point for enemies (start of path)
-    void SetSpawnPoint(Vector2 point);
+    // -------------------- Endless Mode --------------------
+    
+    // Endless mode generates wave N by formula and never completes.
+    // Survives Reset() so the game can toggle it before Init().
+    void SetEndlessMode(bool enabled) { endlessMode = enabled; }
+    bool IsEndlessMode() const { return endlessMode; }
     
-    // Callback when an enemy should be spawned
-    // Parameters: EnemyType, Vector2 spawnPosition
-    void SetOnSpawnEnemy(std::function<void(EnemyType, Vector2)> callback);
+    // Formula-generated wave (0-indexed), used for every wave in endless mode
+    static WaveData GenerateEndlessWave(int waveIndex);
     
-    // Callback when all enemies in current wave are dead
-    void SetOnWaveCleared(std::function<void()> callback);
+    // HP multiplier for enemies spawned by the current wave
+    float GetCurrentHpMultiplier() const;
     
-    // Callback when all waves are completed (victory)
-    void SetOnAllWavesCompleted(std::function<void()> callback);
+    // -------------------- Statistics --------------------
     
-    // Callback for boss warning display
-    void SetOnBossWarning(std::function<void()> callback);
+    // Accumulate frame cost into the current wave's record
+    void RecordFrameCost(double simSeconds, double drawSeconds);
+    
+    // One record per started wave, in order
+    const std::vector<WaveRecord>& GetWaveHistory() const { return waveHistory; }
+    
+    // -------------------- Spawn Configuration --------------------
+    
+    // Set the spawn point for enemies (start of path)
+    void SetSpawnPoint(Vector2 point);
     
     // -------------------- Enemy Death Notification --------------------
     
-    // Called by EnemySystem when an enemy dies (awards gold)
-    void OnEnemyKilled(int reward);
+    // Called with a tick's batch of EnemyKilled events (awards their total gold)
+    void OnEnemiesKilled(int count, int totalReward);
     
-    // Called by EnemySystem when an enemy reaches the base
-    void OnEnemyReachedBase();
+    // Called with a tick's batch of EnemyReachedBase events
+    void OnEnemiesReachedBase(int count);
     
     // Notify that an enemy was removed (for tracking active count)
     void OnEnemyRemoved();
@@ -112,7 +146,7 @@ public:
     int GetTotalWaves() const { return totalWaves; }
     WaveState GetWaveState() const { return waveState; }
     bool IsWaveActive() const { return waveState == WaveState::SPAWNING || waveState == WaveState::IN_PROGRESS; }
-    bool IsLastWave() const { return currentWave >= totalWaves; }
+    bool IsLastWave() const { return !endlessMode && currentWave >= totalWaves; }
     bool IsVictory() const { return waveState == WaveState::COMPLETED; }
     
     // Time until next wave auto-starts (if applicable)
@@ -124,6 +158,10 @@ public:
     // Get active enemy count
     int GetActiveEnemyCount() const { return activeEnemyCount; }
     
+    // "Wave data" (configs, history) and "Spawn queue" (a counter: spawns
+    // are published as EnemySpawnRequested, queued on the event bus)
+    void ReportMemory(MemoryReport& report) const;
+    
     // -------------------- Economy Access --------------------
     
     EconomySystem& GetEconomy() { return economy; }
@@ -161,18 +199,30 @@ private:
     float waveStartTimer;     // Countdown to auto-start next wave
     float bossWarningTimer;   // Timer for boss warning display
     bool autoStartWaves;      // Whether waves auto-start
+    bool endlessMode;         // Waves generated by formula, no victory
     
     // Wave configurations
     std::vector<WaveData> waveConfigs;
+    WaveData activeWave;      // Config of currentWave, cached at StartNextWave
+    
+    // Statistics
+    std::vector<WaveRecord> waveHistory;
+    
+    // Per-instance RNG so parallel simulations don't share rand() state
+    std::mt19937 rng;
     
-    // Callbacks
-    std::function<void(EnemyType, Vector2)> onSpawnEnemy;
-    std::function<void()> onWaveCleared;
-    std::function<void()> onAllWavesCompleted;
-    std::function<void()> onBossWarning;
+    EventBus& events;
     
     // Constants
     static constexpr float DEFAULT_WAVE_DELAY = 5.0f;      // Seconds between waves
     static constexpr float BOSS_WARNING_DURATION = 3.0f;   // Boss warning display time
     static constexpr int STARTING_GOLD = 100;              // Initial gold
+    static constexpr int HISTORY_RESERVE = 64;             // Wave records preallocated per game
+    
+    // Endless mode scaling
+    static constexpr float ENDLESS_COUNT_GROWTH = 1.15f;   // Enemy count growth per wave
+    static constexpr float ENDLESS_HP_GROWTH = 0.12f;      // Extra HP multiplier per wave
+    static constexpr float ENDLESS_SPAWN_WINDOW = 12.0f;   // Seconds to spawn a whole wave
+    static constexpr float ENDLESS_MIN_INTERVAL = 0.0005f; // Spawn interval floor
+    static constexpr int ENDLESS_BOSS_EVERY = 10;          // Boss wave frequency
 };
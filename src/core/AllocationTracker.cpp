@@ -0,0 +1,213 @@
+#include "core/AllocationTracker.h"
+
+#ifdef GOTD_TRACK_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+// All state is thread-local and constant-initialised, so it is safe to
+// touch from inside operator new before any constructors have run.
+static thread_local bool counting = false;
+static thread_local const char* currentScope = nullptr;
+static thread_local AllocationStats total;
+static thread_local AllocationStats scopes[AllocationTracker::MAX_SCOPES];
+static thread_local int scopeCount = 0;
+
+static AllocationStats* FindScope(const char* name)
+{
+    if (!name) name = "(none)";
+    for (int i = 0; i < scopeCount; ++i) {
+        if (scopes[i].scope == name) return &scopes[i];
+    }
+    if (scopeCount < AllocationTracker::MAX_SCOPES) {
+        scopes[scopeCount].scope = name;
+        return &scopes[scopeCount++];
+    }
+    return nullptr;
+}
+
+static void RecordAllocation(size_t bytes)
+{
+    if (!counting) return;
+
+    // Don't count anything the bookkeeping itself might do
+    counting = false;
+    total.allocations++;
+    total.bytes += bytes;
+    if (AllocationStats* stats = FindScope(currentScope)) {
+        stats->allocations++;
+        stats->bytes += bytes;
+    }
+    counting = true;
+}
+
+static void RecordFree()
+{
+    if (!counting) return;
+
+    counting = false;
+    total.frees++;
+    if (AllocationStats* stats = FindScope(currentScope)) {
+        stats->frees++;
+    }
+    counting = true;
+}
+
+// -------------------- Raw allocation --------------------
+
+static void* Allocate(size_t bytes)
+{
+    RecordAllocation(bytes);
+    return std::malloc(bytes ? bytes : 1);
+}
+
+static void* AllocateAligned(size_t bytes, std::align_val_t alignment)
+{
+    RecordAllocation(bytes);
+    size_t align = static_cast<size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(bytes ? bytes : 1, align);
+#else
+    // aligned_alloc wants a size that is a multiple of the alignment
+    size_t rounded = ((bytes ? bytes : 1) + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded);
+#endif
+}
+
+static void Free(void* ptr)
+{
+    if (!ptr) return;
+    RecordFree();
+    std::free(ptr);
+}
+
+static void FreeAligned(void* ptr)
+{
+    if (!ptr) return;
+    RecordFree();
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+// -------------------- Global operator replacements --------------------
+
+void* operator new(size_t bytes)
+{
+    if (void* ptr = Allocate(bytes)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t bytes)
+{
+    if (void* ptr = Allocate(bytes)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept { return Allocate(bytes); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept { return Allocate(bytes); }
+
+void* operator new(size_t bytes, std::align_val_t alignment)
+{
+    if (void* ptr = AllocateAligned(bytes, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t bytes, std::align_val_t alignment)
+{
+    if (void* ptr = AllocateAligned(bytes, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(bytes, alignment);
+}
+
+void* operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(bytes, alignment);
+}
+
+void operator delete(void* ptr) noexcept { Free(ptr); }
+void operator delete[](void* ptr) noexcept { Free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+
+// -------------------- Tracker API --------------------
+
+namespace AllocationTracker {
+
+bool IsEnabled()
+{
+    return true;
+}
+
+void Begin()
+{
+    total = AllocationStats{};
+    for (int i = 0; i < scopeCount; ++i) {
+        scopes[i] = AllocationStats{};
+    }
+    scopeCount = 0;
+    counting = true;
+}
+
+void End()
+{
+    counting = false;
+}
+
+AllocationStats GetTotal()
+{
+    return total;
+}
+
+int GetScopes(AllocationStats* out, int maxCount)
+{
+    int count = scopeCount < maxCount ? scopeCount : maxCount;
+    for (int i = 0; i < count; ++i) {
+        out[i] = scopes[i];
+    }
+    return count;
+}
+
+const char* EnterScope(const char* name)
+{
+    const char* previous = currentScope;
+    currentScope = name;
+    return previous;
+}
+
+void LeaveScope(const char* previous)
+{
+    currentScope = previous;
+}
+
+} // namespace AllocationTracker
+
+#else // !GOTD_TRACK_ALLOCATIONS
+
+namespace AllocationTracker {
+
+bool IsEnabled() { return false; }
+void Begin() {}
+void End() {}
+AllocationStats GetTotal() { return AllocationStats{}; }
+int GetScopes(AllocationStats*, int) { return 0; }
+const char* EnterScope(const char*) { return nullptr; }
+void LeaveScope(const char*) {}
+
+} // namespace AllocationTracker
+
+#endif
@@ -0,0 +1,91 @@
+#include "core/FrameArena.h"
+#include <cstdint>
+#include <new>
+
+static constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+static std::byte* AllocateBlock(size_t bytes)
+{
+    return static_cast<std::byte*>(::operator new(bytes, std::align_val_t(BLOCK_ALIGNMENT)));
+}
+
+static void FreeBlock(std::byte* block)
+{
+    ::operator delete(block, std::align_val_t(BLOCK_ALIGNMENT));
+}
+
+FrameArena::FrameArena(size_t initialCapacity)
+    : block(nullptr)
+    , capacity(initialCapacity > 0 ? initialCapacity : DEFAULT_CAPACITY)
+    , offset(0)
+    , peakBytes(0)
+    , overflowBytes(0)
+    , overflowCount(0)
+{
+    block = AllocateBlock(capacity);
+    overflows.reserve(8);
+}
+
+FrameArena::~FrameArena()
+{
+    for (const Overflow& overflow : overflows) {
+        ::operator delete(overflow.ptr, overflow.bytes, std::align_val_t(overflow.alignment));
+    }
+    FreeBlock(block);
+}
+
+void FrameArena::Reset()
+{
+    size_t used = offset + overflowBytes;
+    if (used > peakBytes) {
+        peakBytes = used;
+    }
+
+    if (!overflows.empty()) {
+        for (const Overflow& overflow : overflows) {
+            ::operator delete(overflow.ptr, overflow.bytes, std::align_val_t(overflow.alignment));
+        }
+        overflows.clear();
+
+        // Grow so a tick of this size fits in the block next time
+        size_t newCapacity = capacity;
+        while (newCapacity < used * 2) {
+            newCapacity *= 2;
+        }
+        FreeBlock(block);
+        block = AllocateBlock(newCapacity);
+        capacity = newCapacity;
+    }
+
+    offset = 0;
+    overflowBytes = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t base = reinterpret_cast<uintptr_t>(block);
+    uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t end = static_cast<size_t>(aligned - base) + bytes;
+
+    if (end <= capacity) {
+        offset = end;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // Block exhausted: fall back to the heap until the next Reset()
+    void* ptr = ::operator new(bytes, std::align_val_t(alignment));
+    overflows.push_back({ ptr, bytes, alignment });
+    overflowBytes += bytes;
+    overflowCount++;
+    return ptr;
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t)
+{
+    // Freed in bulk by Reset()
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
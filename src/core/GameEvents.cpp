@@ -0,0 +1,44 @@
+#include "core/GameEvents.h"
+
+std::atomic<size_t> EventBus::nextTypeId{ 0 };
+
+void EventBus::Dispatch()
+{
+    // Channels are flushed in type-id order; repeat while handlers keep publishing
+    for (int round = 0; round < MAX_DISPATCH_ROUNDS; ++round) {
+        bool delivered = false;
+        for (size_t i = 0; i < channels.size(); ++i) {
+            if (channels[i] && channels[i]->Flush()) {
+                delivered = true;
+            }
+        }
+        if (!delivered) {
+            break;
+        }
+    }
+}
+
+size_t EventBus::PendingCount() const
+{
+    size_t pending = 0;
+    for (const auto& channel : channels) {
+        if (channel) pending += channel->Pending();
+    }
+    return pending;
+}
+
+size_t EventBus::MemoryBytes() const
+{
+    size_t bytes = channels.capacity() * sizeof(std::unique_ptr<IEventChannel>);
+    for (const auto& channel : channels) {
+        if (channel) bytes += channel->MemoryBytes();
+    }
+    return bytes;
+}
+
+void EventBus::Clear()
+{
+    for (auto& channel : channels) {
+        if (channel) channel->Clear();
+    }
+}
@@ -0,0 +1,66 @@
+#include "core/GameRules.h"
+#include "core/GameEvents.h"
+#include "systems/EnemySystem.h"
+#include "systems/WaveSystem.h"
+#include "systems/TowerSystem.h"
+#include "map/Map.h"
+
+#include <algorithm>
+
+namespace GameRules {
+
+void Connect(EventBus& events, EnemySystem& enemySystem, WaveSystem& waveSystem,
+             TowerSystem& towerSystem, Map& gameMap, int& playerHP)
+{
+    WaveManager& waves = waveSystem.GetWaveManager();
+    
+    // Spawn requests from WaveManager become enemies
+    events.Subscribe<EnemySpawnRequested>(
+        [&enemySystem](const EnemySpawnRequested& spawn) {
+            enemySystem.SpawnEnemy(spawn.type, spawn.position, spawn.hpMultiplier);
+        }
+    );
+    
+    // All kills of a tick pay out and leave the wave count in one call
+    events.SubscribeBatch<EnemyKilled>(
+        [&waves](const EnemyKilled* kills, size_t count) {
+            int reward = 0;
+            for (size_t i = 0; i < count; ++i) {
+                reward += kills[i].reward;
+            }
+            waves.OnEnemiesKilled(static_cast<int>(count), reward);
+        }
+    );
+    
+    // Every enemy that arrived costs HP and must leave the wave count
+    events.SubscribeBatch<EnemyReachedBase>(
+        [&waves, &playerHP](const EnemyReachedBase*, size_t count) {
+            playerHP = std::max(0, playerHP - static_cast<int>(count));
+            waves.OnEnemiesReachedBase(static_cast<int>(count));
+        }
+    );
+    
+    // Award wave completion bonus
+    events.Subscribe<WaveCleared>(
+        [&waves](const WaveCleared& cleared) {
+            waves.GetEconomy().AwardWaveCompletionBonus(cleared.wave);
+        }
+    );
+    
+    // Selling a tower refunds part of its invested gold
+    events.Subscribe<TowerSold>(
+        [&waves](const TowerSold& sold) {
+            waves.AddGold(sold.refund);
+        }
+    );
+    
+    // Synchronous queries stay direct callbacks
+    towerSystem.SetCanPlaceAt([&gameMap](Vector2 pos) {
+        return gameMap.CanPlaceTower(pos);
+    });
+    towerSystem.SetOnSpendGold([&waves](int cost) {
+        return waves.SpendGold(cost);
+    });
+}
+
+} // namespace GameRules
@@ -0,0 +1,77 @@
+#include "core/MemoryReport.h"
+
+#include <algorithm>
+
+MemoryReport::MemoryReport()
+    : entryCount(0)
+    , totalBytes(0)
+    , peakTotalBytes(0)
+{
+}
+
+void MemoryReport::Begin()
+{
+    entryCount = 0;
+    totalBytes = 0;
+}
+
+void MemoryReport::Add(const char* name, size_t itemBytes, size_t count, size_t capacity, size_t bytes)
+{
+    if (entryCount >= MAX_ENTRIES) return;
+    
+    MemoryEntry& entry = entries[entryCount++];
+    if (entry.name != name) {
+        // A different entry in this slot: its peaks don't carry over
+        entry = MemoryEntry{};
+        entry.name = name;
+    }
+    entry.itemBytes = itemBytes;
+    entry.count = count;
+    entry.capacity = capacity;
+    entry.bytes = bytes;
+    entry.peakCount = std::max(entry.peakCount, count);
+    entry.peakBytes = std::max(entry.peakBytes, bytes);
+    
+    // Running total only grows during a sample, so the last Add() leaves the real peak
+    totalBytes += bytes;
+    peakTotalBytes = std::max(peakTotalBytes, totalBytes);
+}
+
+void MemoryReport::ResetPeaks()
+{
+    for (MemoryEntry& entry : entries) {
+        entry.peakCount = entry.count;
+        entry.peakBytes = entry.bytes;
+    }
+    peakTotalBytes = totalBytes;
+}
+
+void MemoryReport::Log(const char* label) const
+{
+    TraceLog(LOG_INFO, "MEMORY: %s | total %.1f KB | peak %.1f KB",
+        label, totalBytes / 1024.0, peakTotalBytes / 1024.0);
+    for (int i = 0; i < entryCount; ++i) {
+        const MemoryEntry& entry = entries[i];
+        TraceLog(LOG_INFO,
+            "MEMORY:   %-14s | %7zu live (peak %7zu) / %7zu room | %5zu B each | %9.1f KB (peak %9.1f KB)",
+            entry.name, entry.count, entry.peakCount, entry.capacity, entry.itemBytes,
+            entry.bytes / 1024.0, entry.peakBytes / 1024.0);
+    }
+}
+
+size_t MemoryReport::FontBytes(const Font& font)
+{
+    if (font.glyphCount <= 0) return 0;
+    
+    size_t bytes = static_cast<size_t>(font.glyphCount) * (sizeof(GlyphInfo) + sizeof(Rectangle));
+    if (font.glyphs) {
+        // raylib keeps each glyph's image (grayscale, 1 byte per pixel) after loading
+        for (int i = 0; i < font.glyphCount; ++i) {
+            bytes += static_cast<size_t>(font.glyphs[i].image.width) * font.glyphs[i].image.height;
+        }
+    }
+    
+    // Atlas texture (gray + alpha, 2 bytes per pixel; GPU memory)
+    bytes += static_cast<size_t>(font.texture.width) * font.texture.height * 2;
+    return bytes;
+}
@@ -0,0 +1,55 @@
+#include "core/Registry.h"
+
+std::atomic<size_t> Registry::nextTypeId{ 0 };
+
+Entity Registry::Create()
+{
+    Entity entity;
+    if (!freeList.empty()) {
+        entity.index = freeList.back();
+        freeList.pop_back();
+    } else {
+        entity.index = static_cast<uint32_t>(generations.size());
+        generations.push_back(0);
+        alive.push_back(0);
+    }
+    entity.generation = generations[entity.index];
+    alive[entity.index] = 1;
+    return entity;
+}
+
+void Registry::Destroy(Entity entity)
+{
+    if (!IsAlive(entity)) return;
+
+    for (auto& pool : pools) {
+        if (pool) pool->Remove(entity);
+    }
+
+    // Bump generation so old handles to this slot stop resolving
+    generations[entity.index]++;
+    alive[entity.index] = 0;
+    freeList.push_back(entity.index);
+}
+
+void Registry::ReserveEntities(size_t n)
+{
+    generations.reserve(n);
+    alive.reserve(n);
+    freeList.reserve(n);
+}
+
+size_t Registry::MemoryBytes() const
+{
+    return generations.capacity() * sizeof(uint32_t)
+        + alive.capacity() * sizeof(uint8_t)
+        + freeList.capacity() * sizeof(uint32_t)
+        + pools.capacity() * sizeof(std::unique_ptr<IComponentPool>);
+}
+
+bool Registry::IsAlive(Entity entity) const
+{
+    return entity.index < generations.size()
+        && alive[entity.index]
+        && generations[entity.index] == entity.generation;
+}
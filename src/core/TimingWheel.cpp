@@ -0,0 +1,108 @@
+#include "core/TimingWheel.h"
+
+#include <algorithm>
+
+TimingWheel::TimingWheel()
+    : now(0)
+{
+    std::fill(std::begin(heads), std::end(heads), NONE);
+}
+
+void TimingWheel::Reserve(size_t n)
+{
+    if (nodes.size() < n) {
+        nodes.resize(n);
+    }
+}
+
+void TimingWheel::Schedule(Entity entity, uint32_t tick)
+{
+    if (!entity.IsValid()) return;
+    
+    Reserve(static_cast<size_t>(entity.index) + 1);
+    if (nodes[entity.index].scheduled) {
+        Unlink(entity.index);
+    }
+    
+    Node& node = nodes[entity.index];
+    node.entity = entity;
+    node.tick = std::max(tick, now + 1);
+    
+    // Within the next LEVEL0_SLOTS ticks: exact slot; otherwise its level-1 block
+    uint32_t slot = node.tick - now < LEVEL0_SLOTS
+        ? node.tick & LEVEL0_MASK
+        : LEVEL0_SLOTS + ((node.tick >> LEVEL0_BITS) % LEVEL1_SLOTS);
+    Link(entity.index, slot);
+}
+
+void TimingWheel::Cancel(Entity entity)
+{
+    if (IsScheduled(entity)) {
+        Unlink(entity.index);
+    }
+}
+
+bool TimingWheel::IsScheduled(Entity entity) const
+{
+    return entity.index < nodes.size()
+        && nodes[entity.index].scheduled
+        && nodes[entity.index].entity == entity;
+}
+
+uint32_t TimingWheel::GetTick(Entity entity) const
+{
+    return IsScheduled(entity) ? nodes[entity.index].tick : 0;
+}
+
+void TimingWheel::Clear()
+{
+    for (Node& node : nodes) {
+        node.scheduled = false;
+    }
+    std::fill(std::begin(heads), std::end(heads), NONE);
+    now = 0;
+}
+
+void TimingWheel::Link(uint32_t id, uint32_t slot)
+{
+    Node& node = nodes[id];
+    node.slot = slot;
+    node.prev = NONE;
+    node.next = heads[slot];
+    node.scheduled = true;
+    if (node.next != NONE) {
+        nodes[node.next].prev = id;
+    }
+    heads[slot] = id;
+}
+
+void TimingWheel::Unlink(uint32_t id)
+{
+    Node& node = nodes[id];
+    if (node.prev != NONE) {
+        nodes[node.prev].next = node.next;
+    } else {
+        heads[node.slot] = node.next;
+    }
+    if (node.next != NONE) {
+        nodes[node.next].prev = node.prev;
+    }
+    node.scheduled = false;
+}
+
+void TimingWheel::Cascade()
+{
+    // A new block of LEVEL0_SLOTS ticks starts at `now`: move its entries down to level 0
+    uint32_t block = now >> LEVEL0_BITS;
+    uint32_t slot = LEVEL0_SLOTS + (block % LEVEL1_SLOTS);
+    
+    uint32_t id = heads[slot];
+    while (id != NONE) {
+        uint32_t next = nodes[id].next;
+        if ((nodes[id].tick >> LEVEL0_BITS) == block) {
+            Unlink(id);
+            Link(id, nodes[id].tick & LEVEL0_MASK);
+        }
+        id = next;
+    }
+}
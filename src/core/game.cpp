@@ -1,14 +1,25 @@
 ﻿#include "core/Game.h"
 #include "core/GameConfig.h"
+#include "core/AllocationTracker.h"
+#include "core/GameRules.h"
 #include "raylib.h"
-#include <string>
+#include <algorithm>
+#include <chrono>
+#include <random>
 
 Game::Game()
     : currentState(GameState::MENU)
+    , enemySystem(registry, events)
+    , waveSystem(events)
+    , towerSystem(registry, events)
     , playerHP(MAX_HP)
     , selectedTowerType(TowerType::CORAL_CANNON)
     , placingTower(false)
+    , endlessMode(false)
+    , lastDrawSeconds(0.0)
+    , showMemoryOverlay(false)
 {
+    towerSystem.SetFrameAllocator(&frameArena);
 }
 
 void Game::Init()
@@ -21,7 +32,8 @@ void Game::Init()
     LoadUIFont("assets/fonts/default.ttf", 32);
     
     // Initialize map
-    gameMap.Init(config.screenWidth, config.screenHeight);
+    LoadMap();
+    camera.SetWorldBounds(gameMap.GetWorldBounds());
     
     // Initialize systems
     waveSystem.Init();
@@ -36,6 +48,17 @@ void Game::Init()
     uiSystem.SetScreen(UIScreenState::Start);
 }
 
+void Game::LoadMap()
+{
+    // The --map file if one was given and loads, else the screen-sized default map
+    GameConfig& config = GetGameConfig();
+    if (config.mapFile) {
+        if (gameMap.LoadFromFile(config.mapFile)) return;
+        TraceLog(LOG_WARNING, "MAP: could not load '%s', using the default map", config.mapFile);
+    }
+    gameMap.Init(config.screenWidth, config.screenHeight);
+}
+
 void Game::SetupWaypoints()
 {
     // Get waypoints from map
@@ -67,57 +90,58 @@ void Game::SetupWaypoints()
 
 void Game::ConnectSystems()
 {
-    // Connect WaveManager spawn callback to EnemySystem
-    waveSystem.GetWaveManager().SetOnSpawnEnemy(
-        [this](EnemyType type, Vector2 pos) {
-            enemySystem.SpawnEnemy(type, pos);
+    // Subscriptions are made once; events queued during a tick are delivered
+    // in batches by events.Dispatch() at the end of Update()
+    
+    // Outcome rules (same wiring as the headless Simulation)
+    GameRules::Connect(events, enemySystem, waveSystem, towerSystem, gameMap, playerHP);
+    
+    // Effects: nothing else reads these, so the simulation never pays for them
+    events.Subscribe<EnemyKilled>(
+        [this](const EnemyKilled& kill) {
+            particles.EmitDeath(kill.position, kill.color);
         }
     );
-    
-    // Connect enemy death reward to WaveManager economy
-    enemySystem.SetOnReward(
-        [this](int reward) {
-            waveSystem.GetWaveManager().OnEnemyKilled(reward);
+    events.Subscribe<ProjectileImpact>(
+        [this](const ProjectileImpact& impact) {
+            if (impact.splashRadius > 0.0f) {
+                particles.EmitSplash(impact.position, impact.splashRadius, impact.color);
+            } else {
+                particles.EmitHit(impact.position, impact.color);
+            }
         }
     );
     
-    // Connect wave cleared event
-    waveSystem.GetWaveManager().SetOnWaveCleared(
-        [this]() {
-            // Award wave completion bonus
-            waveSystem.GetWaveManager().GetEconomy().AwardWaveCompletionBonus(
-                waveSystem.GetCurrentWave()
-            );
+    // Footprint at the end of every wave (sizes endless-mode caps)
+    events.Subscribe<WaveCleared>(
+        [this](const WaveCleared& cleared) {
+            SampleMemory();
+            memory.Log(TextFormat("wave %d cleared", cleared.wave));
         }
     );
     
     // Boss warning story cue
-    waveSystem.GetWaveManager().SetOnBossWarning([
-        this
-    ]() {
-        uiSystem.ShowStory(
-            "Voidborn leader approaches!",
-            "Abyss Lord is emerging. Brace your defenses!",
-            3.5f
-        );
-    });
+    events.Subscribe<BossWarning>(
+        [this](const BossWarning&) {
+            uiSystem.ShowStory(
+                "Voidborn leader approaches!",
+                "Abyss Lord is emerging. Brace your defenses!",
+                3.5f
+            );
+        }
+    );
     
     // Connect victory event
-    waveSystem.GetWaveManager().SetOnAllWavesCompleted(
-        [this]() {
+    events.Subscribe<AllWavesCompleted>(
+        [this](const AllWavesCompleted&) {
             currentState = GameState::VICTORY;
             uiSystem.SetScreen(UIScreenState::Victory);
         }
     );
     
-    // Connect tower system to map for placement validation
-    towerSystem.SetCanPlaceAt([this](Vector2 pos) {
-        return gameMap.CanPlaceTower(pos);
-    });
-    
-    // Connect tower system to economy for spending gold
-    towerSystem.SetOnSpendGold([this](int cost) {
-        return waveSystem.GetWaveManager().SpendGold(cost);
+    // Placement preview reads precomputed path coverage from the map
+    towerSystem.SetPathCoverageQuery([this](Vector2 pos, TowerType type) {
+        return gameMap.GetPathCoverageAt(pos, type);
     });
 }
 
@@ -127,7 +151,7 @@ void Game::UpdateHUD()
     hud.hp = playerHP;
     hud.money = waveSystem.GetGold();
     hud.currentWave = waveSystem.GetCurrentWave();
-    hud.totalWaves = waveSystem.GetTotalWaves();
+    hud.totalWaves = endlessMode ? 0 : waveSystem.GetTotalWaves();
     uiSystem.SetHUDData(hud);
 }
 
@@ -168,15 +192,9 @@ void Game::HandleInput()
     {
     case GameState::MENU:
         if (IsKeyPressed(KEY_ENTER)) {
-            currentState = GameState::GAME;
-            uiSystem.SetScreen(UIScreenState::PlayingHUD);
-            ResetGame();
-            uiSystem.ShowStory(
-                "Depths stir with darkness...",
-                "Protect Aria and the heart of Aqualis!",
-                3.8f
-            );
-            waveSystem.StartNextWave();
+            StartGame(false);
+        } else if (IsKeyPressed(KEY_E)) {
+            StartGame(true);
         }
         break;
 
@@ -192,7 +210,7 @@ void Game::HandleInput()
                 int nextWave = waveSystem.GetCurrentWave() + 1;
                 waveSystem.StartNextWave();
                 uiSystem.ShowStory(
-                    "Wave " + std::to_string(nextWave) + " incoming!",
+                    TextFormat("Wave %d incoming!", nextWave),
                     "Voidborn surge through the currents...",
                     2.6f
                 );
@@ -208,6 +226,9 @@ void Game::HandleInput()
             currentState = GameState::GAMEOVER;
             uiSystem.SetScreen(UIScreenState::GameOver);
         }
+        if (IsKeyPressed(KEY_F3)) {
+            showMemoryOverlay = !showMemoryOverlay;
+        }
         
         // Tower selection keys (1, 2, 3)
         if (IsKeyPressed(KEY_ONE)) {
@@ -223,6 +244,17 @@ void Game::HandleInput()
             placingTower = true;
         }
         
+        // Upgrade / sell the selected tower
+        if (IsKeyPressed(KEY_U)) {
+            towerSystem.TryUpgradeSelected();
+        }
+        if (IsKeyPressed(KEY_X)) {
+            towerSystem.SellSelected();
+        }
+        if (IsKeyPressed(KEY_T)) {
+            towerSystem.CycleSelectedTargeting();
+        }
+        
         // Cancel tower placement with right click
         if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)) {
             placingTower = false;
@@ -252,39 +284,88 @@ void Game::HandleInput()
     }
 }
 
+void Game::StartGame(bool endless)
+{
+    endlessMode = endless;
+    currentState = GameState::GAME;
+    uiSystem.SetScreen(UIScreenState::PlayingHUD);
+    ResetGame();
+    uiSystem.ShowStory(
+        endless ? "The abyss has no bottom..." : "Depths stir with darkness...",
+        endless ? "Hold out as long as Aqualis can." : "Protect Aria and the heart of Aqualis!",
+        3.8f
+    );
+    waveSystem.StartNextWave();
+}
+
 void Game::Update()
 {
     float dt = GetFrameTime();
     uiSystem.Update(dt);
 
+    if (currentState == GameState::GAME || currentState == GameState::PAUSE) {
+        camera.Update(dt);
+    }
+
     if (currentState != GameState::GAME)
         return;
 
+    auto simStart = std::chrono::steady_clock::now();
+
     // === Wave System (handles spawning) ===
-    waveSystem.Update(dt);
+    {
+        AllocationScope scope("WaveSystem");
+        waveSystem.Update(dt);
+    }
 
     // === Enemy System ===
-    enemySystem.Update(dt);
+    {
+        AllocationScope scope("EnemySystem");
+        enemySystem.Update(dt);
+    }
 
     // === Tower System (with enemy targeting) ===
-    towerSystem.Update(dt, enemySystem.GetManager().GetEnemies());
+    {
+        AllocationScope scope("TowerSystem");
+        towerSystem.Update(dt, enemySystem.GetManager());
+    }
+    
+    // === Deliver this tick's events in batches ===
+    {
+        AllocationScope scope("Events");
+        events.Dispatch();
+    }
+    
+    // === Effects (after dispatch, so this tick's hits and kills show up) ===
+    {
+        AllocationScope scope("Particles");
+        particles.Update(dt);
+    }
+    
+    // Everything allocated from the frame arena this tick is dead now
+    frameArena.Reset();
+    
+    std::chrono::duration<double> simTime = std::chrono::steady_clock::now() - simStart;
+    waveSystem.GetWaveManager().RecordFrameCost(simTime.count(), lastDrawSeconds);
+    
+    // Outside the timed section: keeps the peaks current for the overlay and logs
+    SampleMemory();
     
     // Update HUD preview position for tower placement
     if (placingTower) {
-        Vector2 mousePos = GetMousePosition();
+        Vector2 mousePos = camera.ScreenToWorld(GetMousePosition());
         Vector2 snappedPos = gameMap.SnapToGrid(mousePos);
         towerSystem.SetSelectedTowerType(selectedTowerType);
         towerSystem.SetPreviewPosition(snappedPos);
     }
 
     // === GAME OVER CHECK ===
-    if (enemySystem.HasEnemyReachedEnd()) {
-        playerHP--;
-        waveSystem.GetWaveManager().OnEnemyReachedBase();
+    if (playerHP <= 0) {
+        currentState = GameState::GAMEOVER;
+        uiSystem.SetScreen(UIScreenState::GameOver);
         
-        if (playerHP <= 0) {
-            currentState = GameState::GAMEOVER;
-            uiSystem.SetScreen(UIScreenState::GameOver);
+        if (endlessMode) {
+            ReportEndlessRun();
         }
     }
 
@@ -300,6 +381,8 @@ void Game::Update()
 
 void Game::Draw()
 {
+    auto drawStart = std::chrono::steady_clock::now();
+
     BeginDrawing();
     ClearBackground({12, 28, 52, 255}); // Polished ocean tone
 
@@ -310,14 +393,27 @@ void Game::Draw()
         break;
 
     case GameState::GAME:
+    {
+        // World: map, enemies and towers through the camera, culled to the view
+        Rectangle view = camera.GetVisibleWorld();
+        
+        // Bake map chunks coming into view (render textures, so outside the camera)
+        gameMap.StreamChunks(view);
+        camera.BeginWorld();
+        
         // Draw map first (background)
-        gameMap.Draw();
+        gameMap.Draw(view);
         
         // Draw enemies
-        enemySystem.Draw();
+        enemySystem.Draw(view);
         
         // Draw towers
-        towerSystem.Draw();
+        towerSystem.Draw(view);
+        
+        // Effects on top
+        particles.Draw(view);
+        
+        camera.EndWorld();
         
         // Draw tower selection UI
         DrawTowerUI();
@@ -325,6 +421,10 @@ void Game::Draw()
         // Draw HUD + story banner
         uiSystem.Draw();
         
+        if (showMemoryOverlay) {
+            DrawMemoryOverlay();
+        }
+        
         // Draw wave status
         {
             const char* waveStatus = "";
@@ -348,16 +448,32 @@ void Game::Draw()
             DrawText(waveStatus, 400, 680, 20, YELLOW);
         }
         break;
+    }
 
     case GameState::PAUSE:
-        gameMap.Draw();
-        enemySystem.Draw();
-        towerSystem.Draw();
+    {
+        Rectangle view = camera.GetVisibleWorld();
+        gameMap.StreamChunks(view);
+        camera.BeginWorld();
+        gameMap.Draw(view);
+        enemySystem.Draw(view);
+        towerSystem.Draw(view);
+        particles.Draw(view);
+        camera.EndWorld();
         uiSystem.Draw();
         break;
+    }
 
     case GameState::GAMEOVER:
         uiSystem.Draw();
+        if (endlessMode) {
+            // Centred under the game over lines (those end at 58% of the screen height)
+            GameConfig& config = GetGameConfig();
+            const char* reached = TextFormat("Endless: reached wave %d", waveSystem.GetCurrentWave());
+            const int fontSize = 20;
+            DrawText(reached, (config.screenWidth - MeasureText(reached, fontSize)) / 2,
+                static_cast<int>(config.screenHeight * 0.66f), fontSize, YELLOW);
+        }
         break;
 
     case GameState::VICTORY:
@@ -366,6 +482,9 @@ void Game::Draw()
     }
 
     EndDrawing();
+
+    std::chrono::duration<double> drawTime = std::chrono::steady_clock::now() - drawStart;
+    lastDrawSeconds = drawTime.count();
 }
 
 void Game::ResetGame()
@@ -376,22 +495,104 @@ void Game::ResetGame()
     
     enemySystem.Reset();
     towerSystem.Reset();
+    particles.Clear();
+    waveSystem.GetWaveManager().SetEndlessMode(endlessMode);
     waveSystem.Reset();
     waveSystem.Init();
     
+    // Fresh wave compositions every game (the headless Simulation seeds explicitly)
+    waveSystem.GetWaveManager().SetSeed(std::random_device{}());
+    
     // Reinitialize map
-    GameConfig& config = GetGameConfig();
-    gameMap.Init(config.screenWidth, config.screenHeight);
+    LoadMap();
+    camera.Reset();
+    camera.SetWorldBounds(gameMap.GetWorldBounds());
     
-    ConnectSystems();
+    // Drop events queued by the previous game (subscriptions stay)
+    events.Clear();
     SetupWaypoints();
+    
+    // Peaks start over with each game (from what the last one left reserved)
+    SampleMemory();
+    memory.ResetPeaks();
+}
+
+void Game::ReportEndlessRun() const
+{
+    const std::vector<WaveRecord>& history = waveSystem.GetWaveManager().GetWaveHistory();
+    
+    TraceLog(LOG_INFO, "ENDLESS: reached wave %d", waveSystem.GetCurrentWave());
+    for (const WaveRecord& record : history) {
+        double frames = record.frames > 0 ? static_cast<double>(record.frames) : 1.0;
+        TraceLog(LOG_INFO,
+            "ENDLESS: wave %3d | enemies %6d | hp x%.2f | peak %6d | sim %.3f ms/frame | draw %.3f ms/frame",
+            record.wave, record.enemyCount, record.hpMultiplier, record.peakActiveEnemies,
+            record.simSeconds * 1000.0 / frames, record.drawSeconds * 1000.0 / frames);
+    }
+    
+    // Peaks over the whole run: what the entity caps have to fit in
+    memory.Log("endless run");
+}
+
+void Game::SampleMemory()
+{
+    memory.Begin();
+    memory.Add("Registry", 0, registry.AliveCount(), registry.EntityCapacity(), registry.MemoryBytes());
+    enemySystem.ReportMemory(memory);
+    towerSystem.ReportMemory(memory);
+    waveSystem.GetWaveManager().ReportMemory(memory);
+    gameMap.ReportMemory(memory);
+    particles.ReportMemory(memory);
+    memory.Add("Events", 0, events.PendingCount(), 0, events.MemoryBytes());
+    
+    // Arena counts bytes: "live" is the high-water mark of one tick
+    memory.Add("Frame arena", 1, frameArena.GetPeakBytes(), frameArena.GetCapacity(), frameArena.GetCapacity());
+    uiSystem.ReportMemory(memory);
+}
+
+void Game::DrawMemoryOverlay() const
+{
+    const int fontSize = 10;
+    const int rowHeight = 14;
+    const int width = 470;
+    const int x = GetGameConfig().screenWidth - width - 10;
+    const int y = 150;      // Below the story banner
+    const int height = rowHeight * (memory.GetEntryCount() + 2) + 8;
+    
+    DrawRectangle(x, y, width, height, { 0, 0, 0, 190 });
+    DrawText(TextFormat("MEMORY (F3)   total %.1f KB   peak %.1f KB",
+        memory.GetTotalBytes() / 1024.0, memory.GetPeakTotalBytes() / 1024.0), x + 6, y + 4, fontSize, YELLOW);
+    
+    // Columns: name | live (peak) | room | bytes each | KB (peak KB)
+    int rowY = y + 4 + rowHeight;
+    DrawText("system", x + 6, rowY, fontSize, GRAY);
+    DrawText("live (peak)", x + 100, rowY, fontSize, GRAY);
+    DrawText("room", x + 200, rowY, fontSize, GRAY);
+    DrawText("B each", x + 260, rowY, fontSize, GRAY);
+    DrawText("KB (peak)", x + 330, rowY, fontSize, GRAY);
+    
+    for (int i = 0; i < memory.GetEntryCount(); ++i) {
+        const MemoryEntry& entry = memory.GetEntry(i);
+        rowY += rowHeight;
+        DrawText(entry.name, x + 6, rowY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%zu (%zu)", entry.count, entry.peakCount), x + 100, rowY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%zu", entry.capacity), x + 200, rowY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%zu", entry.itemBytes), x + 260, rowY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%.1f (%.1f)", entry.bytes / 1024.0, entry.peakBytes / 1024.0), x + 330, rowY, fontSize, RAYWHITE);
+    }
 }
 
 void Game::HandleTowerPlacement()
 {
-    if (!placingTower) return;
+    if (!placingTower) {
+        // Not placing: left click selects a tower for upgrade/sell
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            towerSystem.HandleClick(camera.ScreenToWorld(GetMousePosition()));
+        }
+        return;
+    }
     
-    Vector2 mousePos = GetMousePosition();
+    Vector2 mousePos = camera.ScreenToWorld(GetMousePosition());
     Vector2 snappedPos = gameMap.SnapToGrid(mousePos);
     
     // Left click to place
@@ -438,4 +639,24 @@ void Game::DrawTowerUI()
     } else {
         DrawText("Press 1/2/3 to select tower", panelX, panelY + 60, 14, GRAY);
     }
+    
+    // Selected tower panel (upgrade / sell)
+    const Tower* selected = towerSystem.GetSelectedTower();
+    if (selected) {
+        int infoX = panelX + 370;
+        DrawRectangle(infoX - 5, panelY - 5, 300, 80, {0, 0, 0, 150});
+        DrawText(TextFormat("%s  Lv %d/%d", GetTowerName(selected->GetType()),
+            selected->GetLevel() + 1, TOWER_MAX_LEVEL), infoX, panelY, 16, WHITE);
+        
+        if (selected->CanUpgrade()) {
+            int upgradeCost = selected->GetUpgradeCost();
+            Color upColor = waveSystem.CanAfford(upgradeCost) ? GREEN : GRAY;
+            DrawText(TextFormat("[U] Upgrade - %dg", upgradeCost), infoX, panelY + 20, 16, upColor);
+        } else {
+            DrawText("Max level", infoX, panelY + 20, 16, GOLD);
+        }
+        DrawText(TextFormat("[X] Sell - %dg", selected->GetSellValue()), infoX, panelY + 40, 16, WHITE);
+        DrawText(TextFormat("[T] Target: %s", GetTargetingModeName(selected->GetTargetingMode())),
+            infoX, panelY + 60, 16, SKYBLUE);
+    }
 }
@@ -1,45 +1,309 @@
 #include "enemy/EnemyManager.h"
+#include "core/MemoryReport.h"
 
 #include <algorithm>
+#include <cmath>
 
-void EnemyManager::AddEnemy(const Enemy& e)
+EnemyManager::EnemyManager(Registry& registry)
+    : registry(registry)
+    , pool(registry.Pool<Enemy>())
+    , path(nullptr)
+    , pathVersion(0)
+    , clock(0.0)
+    , currentTick(0)
+    , pendingRemovals(0)
+    , separationCursor(0)
+    , crowdGrid(2.0f * SEPARATION_RADIUS)
+    , rangesView{ 0, 0, 0, 0 }
+    , rangesPathVersion(0)
 {
-    enemies.push_back(e);
+    pool.Reserve(INITIAL_CAPACITY);
+    arrivals.Reserve(INITIAL_CAPACITY);
+    slowExpiries.Reserve(INITIAL_CAPACITY);
+    moveIndex.reserve(INITIAL_CAPACITY);
+    moveStep.reserve(INITIAL_CAPACITY);
+    moveX.reserve(INITIAL_CAPACITY);
+    moveY.reserve(INITIAL_CAPACITY);
+    moveDistance.reserve(INITIAL_CAPACITY);
+    moveOffset.reserve(INITIAL_CAPACITY);
+    movePathOffset.reserve(INITIAL_CAPACITY);
+    crowdGrid.Reserve(INITIAL_CAPACITY);
 }
 
-void EnemyManager::Update(float dt, const std::vector<Vector2>& waypoints)
+void EnemyManager::SetPath(const PathSamples* samples)
 {
-    // Update all enemies first
-    for (auto& e : enemies) {
-        e.Update(dt, waypoints);
+    path = samples;
+    pathVersion++;
+
+    // Positions on the old path are stale
+    const std::vector<Entity>& entities = pool.Entities();
+    for (size_t i = 0; i < entities.size(); ++i) {
+        ScheduleArrival(entities[i], pool.Components()[i]);
+        pool.Components()[i].positionTime = -1.0;
+    }
+}
+
+Entity EnemyManager::AddEnemy(const Enemy& e)
+{
+    Entity entity = registry.Create();
+    Enemy& added = registry.Emplace<Enemy>(entity, e);
+    added.baseTime = clock;
+    added.distance = added.baseDistance;
+
+    // Spread spawns over five lanes so a burst doesn't start on one pixel
+    added.laneOffset = static_cast<float>(static_cast<int>(entity.index % 5) - 2) * (MAX_LANE_OFFSET * 0.25f);
+
+    ScheduleArrival(entity, added);
+    return entity;
+}
+
+void EnemyManager::ScheduleArrival(Entity entity, const Enemy& e)
+{
+    if (!path || path->Count() == 0 || e.speed <= 0.0f) {
+        arrivals.Cancel(entity);   // Never gets there (or no path to walk)
+        return;
+    }
+
+    // First tick at or after the moment baseDistance + speed * t reaches the end
+    double arrival = e.baseTime + std::max(path->length - e.baseDistance, 0.0f) / e.speed;
+    arrivals.Schedule(entity, std::max(TimingWheel::TicksFor(arrival), currentTick + 1));
+}
+
+void EnemyManager::SetSpeed(Enemy& enemy, float speed)
+{
+    // Re-base at the current clock so the distance walked so far is kept
+    float walked = enemy.speed * static_cast<float>(clock - enemy.baseTime);
+    enemy.baseDistance = path ? std::clamp(enemy.baseDistance + walked, 0.0f, path->length) : enemy.baseDistance;
+    enemy.baseTime = clock;
+    enemy.speed = speed;
+
+    if (enemy.alive) {
+        ScheduleArrival(pool.EntityOf(&enemy), enemy);
+    }
+}
+
+void EnemyManager::ApplySlow(Enemy& enemy, float amount, float duration)
+{
+    if (!enemy.alive || amount <= 0.0f || duration <= 0.0f) return;
+
+    // Lasts at least one tick
+    uint32_t until = currentTick + std::max(TimingWheel::TicksFor(duration), 1u);
+    if (enemy.slowAmount <= 0.0f || until > enemy.slowUntilTick) {
+        enemy.slowUntilTick = until;
+        slowExpiries.Schedule(pool.EntityOf(&enemy), until);
+    }
+
+    float strength = std::min(std::max(amount, enemy.slowAmount), 1.0f);
+    if (strength != enemy.slowAmount) {
+        enemy.slowAmount = strength;
+        SetSpeed(enemy, enemy.baseSpeed * (1.0f - strength));
     }
+}
+
+void EnemyManager::Update(float dt)
+{
+    clock += dt;
+    currentTick = TimingWheel::TickAt(clock);
+
+    // Slows running out this update: back to full speed (before arrivals are due)
+    slowExpiries.Advance(currentTick, [this](Entity entity) {
+        Enemy* e = pool.TryGet(entity);
+        if (!e || !e->alive) return;
+
+        e->slowAmount = 0.0f;
+        SetSpeed(*e, e->baseSpeed);
+    });
+
+    // Only enemies reaching the base this update are touched
+    arrivals.Advance(currentTick, [this](Entity entity) {
+        Enemy* e = pool.TryGet(entity);
+        if (!e || !e->alive) return;   // Killed (and maybe removed) before getting there
+
+        e->alive = false; // Mark for removal below
+        pendingRemovals++;
+
+        // Notify the system that an enemy reached the end.
+        if (e->events && e->events->onReachedEnd) {
+            e->events->onReachedEnd();
+        }
+    });
 
     // Remove dead enemies (killed or reached the end)
-    enemies.erase(
-        std::remove_if(enemies.begin(), enemies.end(),
-            [](const Enemy& e) { return !e.alive; }),
-        enemies.end()
-    );
+    if (pendingRemovals > 0) {
+        registry.DestroyIf<Enemy>([](const Enemy& e) { return !e.alive; });
+        pendingRemovals = 0;
+    }
+}
+
+void EnemyManager::ResolvePositions(const PathRanges& ranges)
+{
+    if (!path || path->Count() == 0) return;   // Enemies stay where they were spawned
+
+    // Distance now, from each enemy's base; the ones in ranges go into contiguous
+    // arrays for the SIMD lookup
+    std::vector<Enemy>& enemies = pool.Components();
+    moveIndex.resize(enemies.size());
+    moveStep.resize(enemies.size());
+    moveDistance.resize(enemies.size());
+    moveOffset.resize(enemies.size());
+    movePathOffset.resize(enemies.size());
+    size_t count = 0;
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        const Enemy& e = enemies[i];
+        if (e.positionTime == clock) continue;
+
+        float walked = e.baseDistance + e.speed * static_cast<float>(clock - e.baseTime);
+        float distance = std::clamp(walked + e.pathOffset, 0.0f, path->length);
+        if (!ranges.Contains(distance)) continue;
+
+        // Separation catches up on the time since this enemy was last resolved
+        moveIndex[count] = static_cast<uint32_t>(i);
+        moveStep[count] = static_cast<float>(std::min(clock - e.positionTime, static_cast<double>(MAX_SEPARATION_STEP)));
+        moveDistance[count] = distance;
+        moveOffset[count] = e.laneOffset;
+        movePathOffset[count] = e.pathOffset;
+        count++;
+    }
+    if (count == 0) return;
+
+    moveX.resize(count);
+    moveY.resize(count);
+    EnemyMovement::Evaluate(*path, moveDistance.data(), moveOffset.data(), moveX.data(), moveY.data(), count);
+    SeparateCrowd(count);
+
+    for (size_t k = 0; k < count; ++k) {
+        Enemy& e = enemies[moveIndex[k]];
+        e.position = { moveX[k], moveY[k] };
+        e.laneOffset = moveOffset[k];
+        e.pathOffset = movePathOffset[k];
+        e.distance = moveDistance[k];
+        e.positionTime = clock;
+    }
+}
+
+void EnemyManager::SeparateCrowd(size_t count)
+{
+    if (count < 2) return;
+
+    crowdGrid.Build(moveX.data(), moveY.data(), count);
+
+    // Past the budget, each enemy is steered every count / budget passes; scale its step to match
+    size_t budget = std::min(count, SEPARATION_BUDGET);
+    float sliceScale = static_cast<float>(count) / static_cast<float>(budget);
+    if (separationCursor >= count) separationCursor = 0;
+
+    int neighbors[MAX_NEIGHBORS + 1];   // + the enemy itself
+    for (size_t n = 0; n < budget; ++n) {
+        size_t i = (separationCursor + n) % count;
+        float sliceStep = moveStep[i] * sliceScale;
+        if (sliceStep <= 0.0f) continue;
+
+        Vector2 self = { moveX[i], moveY[i] };
+        Vector2 normal = path->NormalAt(moveDistance[i]);
+        Vector2 tangent = { normal.y, -normal.x };
+
+        // Push away from each neighbour, harder the more they overlap, split into
+        // sideways (lane) and along-path parts; coincident enemies split by index
+        float pushLane = 0.0f;
+        float pushPath = 0.0f;
+        size_t found = crowdGrid.QueryRadius(self, SEPARATION_RADIUS, neighbors, MAX_NEIGHBORS + 1);
+        for (size_t k = 0; k < found; ++k) {
+            size_t j = static_cast<size_t>(neighbors[k]);
+            if (j == i) continue;
+
+            float dx = self.x - moveX[j];
+            float dy = self.y - moveY[j];
+            float dist = std::sqrt(dx * dx + dy * dy);
+            if (dist < 0.01f) {
+                float side = i < j ? 1.0f : -1.0f;
+                pushLane += side;
+                pushPath += side;
+                continue;
+            }
+            float weight = (1.0f - dist / SEPARATION_RADIUS) / dist;
+            pushLane += (dx * normal.x + dy * normal.y) * weight;
+            pushPath += (dx * tangent.x + dy * tangent.y) * weight;
+        }
+
+        float offset = moveOffset[i] + (pushLane * SEPARATION_SPEED - moveOffset[i] * LANE_RECENTER) * sliceStep;
+        offset = std::clamp(offset, -MAX_LANE_OFFSET, MAX_LANE_OFFSET);
+        float laneDelta = offset - moveOffset[i];
+        float along = movePathOffset[i]
+            + (pushPath * SEPARATION_SPEED * PATH_PUSH_SCALE - movePathOffset[i] * LANE_RECENTER) * sliceStep;
+        along = std::clamp(along, -MAX_PATH_OFFSET, MAX_PATH_OFFSET);
+        float pathDelta = along - movePathOffset[i];
+
+        moveX[i] += normal.x * laneDelta + tangent.x * pathDelta;
+        moveY[i] += normal.y * laneDelta + tangent.y * pathDelta;
+        moveOffset[i] = offset;
+        movePathOffset[i] = along;
+        moveDistance[i] = std::clamp(moveDistance[i] + pathDelta, 0.0f, path->length);
+    }
+    separationCursor = (separationCursor + budget) % count;
 }
 
-void EnemyManager::Draw() const
+void EnemyManager::Draw(Rectangle view)
 {
-    for (const auto& e : enemies) {
+    // Margin covers the enemy radius and the HP bar above it
+    float minX = view.x - DRAW_MARGIN;
+    float minY = view.y - DRAW_MARGIN;
+    float maxX = view.x + view.width + DRAW_MARGIN;
+    float maxY = view.y + view.height + DRAW_MARGIN;
+
+    // Stretches of path in view, recomputed only when the camera or path moves
+    bool onPath = path && path->Count() > 0;
+    if (onPath && (view.x != rangesView.x || view.y != rangesView.y || view.width != rangesView.width
+                 || view.height != rangesView.height || rangesPathVersion != pathVersion)) {
+        float pad = MAX_LANE_OFFSET;
+        viewRanges.Clear();
+        path->AddRangesIn({ minX - pad, minY - pad, maxX - minX + 2.0f * pad, maxY - minY + 2.0f * pad }, viewRanges);
+        viewRanges.Normalize();
+        rangesView = view;
+        rangesPathVersion = pathVersion;
+    }
+    ResolvePositions(viewRanges);
+
+    for (const auto& e : pool.Components()) {
+        if (onPath && !IsPositionCurrent(e)) continue;  // Not walking in view
+        if (e.position.x < minX || e.position.x > maxX || e.position.y < minY || e.position.y > maxY) continue;
         e.Draw(true);
     }
 }
 
 int EnemyManager::AliveCount() const
 {
-    return (int)enemies.size();
+    return (int)pool.Size();
 }
 
 bool EnemyManager::IsEmpty() const
 {
-    return enemies.empty();
+    return pool.Size() == 0;
 }
 
 void EnemyManager::Clear()
 {
-    enemies.clear();
+    registry.DestroyAll<Enemy>();
+    arrivals.Clear();
+    slowExpiries.Clear();
+    clock = 0.0;
+    currentTick = 0;
+    pendingRemovals = 0;
+    separationCursor = 0;
+}
+
+void EnemyManager::ReportMemory(MemoryReport& report) const
+{
+    size_t bytes = pool.MemoryBytes()
+        + MemoryReport::VectorBytes(viewRanges.ranges)
+        + MemoryReport::VectorBytes(moveIndex)
+        + MemoryReport::VectorBytes(moveStep)
+        + MemoryReport::VectorBytes(moveX)
+        + MemoryReport::VectorBytes(moveY)
+        + MemoryReport::VectorBytes(moveDistance)
+        + MemoryReport::VectorBytes(moveOffset)
+        + MemoryReport::VectorBytes(movePathOffset)
+        + arrivals.MemoryBytes()
+        + slowExpiries.MemoryBytes()
+        + crowdGrid.MemoryBytes();
+    report.Add("Enemies", sizeof(Enemy), pool.Size(), pool.Capacity(), bytes);
 }
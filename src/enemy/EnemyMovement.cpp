@@ -0,0 +1,305 @@
+#include "enemy/EnemyMovement.h"
+#include "map/Path.h"
+#include "utils/Math.h"
+#include "utils/Simd.h"
+
+#include <algorithm>
+#include <cmath>
+
+// ============================================================
+// PathRanges
+// ============================================================
+void PathRanges::Normalize()
+{
+    if (ranges.empty()) return;
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const PathRange& a, const PathRange& b) { return a.begin < b.begin; });
+    size_t merged = 0;
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        if (ranges[i].begin <= ranges[merged].end) {
+            ranges[merged].end = std::max(ranges[merged].end, ranges[i].end);
+        } else {
+            ranges[++merged] = ranges[i];
+        }
+    }
+    ranges.resize(merged + 1);
+}
+
+bool PathRanges::Contains(float distance) const
+{
+    // Last range starting at or before distance
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), distance,
+                               [](float d, const PathRange& r) { return d < r.begin; });
+    return it != ranges.begin() && distance <= (it - 1)->end;
+}
+
+// ============================================================
+// PathSamples
+// ============================================================
+void PathSamples::Build(const std::vector<Vector2>& waypoints, float targetSpacing)
+{
+    Path path;
+    path.SetWaypoints(waypoints);
+
+    std::vector<Vector2> samples;
+    spacing = path.Tessellate(targetSpacing, samples);
+    invSpacing = spacing > 0.0f ? 1.0f / spacing : 0.0f;
+    length = spacing * static_cast<float>(samples.empty() ? 0 : samples.size() - 1);
+
+    size_t count = samples.size();
+    x.resize(count);
+    y.resize(count);
+    nx.resize(count);
+    ny.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = samples[i].x;
+        y[i] = samples[i].y;
+
+        // Central difference (one-sided at the ends)
+        Vector2 tangent = MathUtils::Direction(samples[i > 0 ? i - 1 : 0], samples[std::min(i + 1, count - 1)]);
+        nx[i] = -tangent.y;
+        ny[i] = tangent.x;
+    }
+}
+
+Vector2 PathSamples::PositionAt(float distance) const
+{
+    if (x.empty()) return { 0, 0 };
+
+    float s = std::clamp(distance, 0.0f, length) * invSpacing;
+    int i = std::min(static_cast<int>(s), Count() - 2);
+    float f = s - static_cast<float>(i);
+    return { x[i] + (x[i + 1] - x[i]) * f, y[i] + (y[i + 1] - y[i]) * f };
+}
+
+Vector2 PathSamples::NormalAt(float distance) const
+{
+    if (x.empty()) return { 0, 0 };
+
+    float s = std::clamp(distance, 0.0f, length) * invSpacing;
+    int i = std::min(static_cast<int>(s), Count() - 2);
+    float f = s - static_cast<float>(i);
+    return MathUtils::Normalize({ nx[i] + (nx[i + 1] - nx[i]) * f, ny[i] + (ny[i + 1] - ny[i]) * f });
+}
+
+// One pass over the samples: runs of samples passing `inside` become ranges
+template <typename Fn>
+static void AddSampleRuns(const PathSamples& path, PathRanges& out, Fn&& inside)
+{
+    int count = path.Count();
+    int runStart = -1;
+    for (int i = 0; i <= count; ++i) {
+        bool in = i < count && inside(path.x[i], path.y[i]);
+        if (in && runStart < 0) {
+            runStart = i;
+        } else if (!in && runStart >= 0) {
+            out.Add(std::max(static_cast<float>(runStart - 1) * path.spacing, 0.0f),
+                    std::min(static_cast<float>(i) * path.spacing, path.length));
+            runStart = -1;
+        }
+    }
+}
+
+void PathSamples::AddRangesNear(Vector2 center, float radius, PathRanges& out) const
+{
+    float radiusSq = radius * radius;
+    AddSampleRuns(*this, out, [center, radiusSq](float px, float py) {
+        float dx = px - center.x;
+        float dy = py - center.y;
+        return dx * dx + dy * dy <= radiusSq;
+    });
+}
+
+void PathSamples::AddRangesIn(Rectangle rect, PathRanges& out) const
+{
+    AddSampleRuns(*this, out, [rect](float px, float py) {
+        return px >= rect.x && px <= rect.x + rect.width && py >= rect.y && py <= rect.y + rect.height;
+    });
+}
+
+namespace EnemyMovement {
+
+// ============================================================
+// Scalar kernel (reference, and tail of the SIMD kernels)
+// ============================================================
+void EvaluateScalar(const PathSamples& path, float* distance, const float* offset,
+                    float* x, float* y, size_t count)
+{
+    const int last = path.Count() - 2;   // Last interval start
+
+    for (size_t i = 0; i < count; ++i) {
+        float d = std::clamp(distance[i], 0.0f, path.length);
+        float s = d * path.invSpacing;
+        int k = std::min(static_cast<int>(s), last);
+        float f = s - static_cast<float>(k);
+
+        float normalX = path.nx[k] + (path.nx[k + 1] - path.nx[k]) * f;
+        float normalY = path.ny[k] + (path.ny[k + 1] - path.ny[k]) * f;
+
+        x[i] = path.x[k] + (path.x[k + 1] - path.x[k]) * f + normalX * offset[i];
+        y[i] = path.y[k] + (path.y[k + 1] - path.y[k]) * f + normalY * offset[i];
+        distance[i] = d;
+    }
+}
+
+#if defined(GOTD_SIMD_X86)
+
+// ============================================================
+// AVX2 kernel: 8 enemies per step, samples via gathers
+// ============================================================
+GOTD_TARGET_AVX2
+static size_t EvaluateAVX2(const PathSamples& path, float* distance, const float* offset,
+                           float* x, float* y, size_t count)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 lengthVec = _mm256_set1_ps(path.length);
+    const __m256 invSpacingVec = _mm256_set1_ps(path.invSpacing);
+    const __m256i lastVec = _mm256_set1_epi32(path.Count() - 2);
+    const float* sx = path.x.data();
+    const float* sy = path.y.data();
+    const float* snx = path.nx.data();
+    const float* sny = path.ny.data();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 d = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(distance + i), zero), lengthVec);
+
+        // Interval index (truncation = floor, d >= 0) and position inside it
+        __m256 s = _mm256_mul_ps(d, invSpacingVec);
+        __m256i k = _mm256_min_epi32(_mm256_cvttps_epi32(s), lastVec);
+        __m256 f = _mm256_sub_ps(s, _mm256_cvtepi32_ps(k));
+
+        __m256 x0 = _mm256_i32gather_ps(sx, k, 4);
+        __m256 x1 = _mm256_i32gather_ps(sx + 1, k, 4);
+        __m256 y0 = _mm256_i32gather_ps(sy, k, 4);
+        __m256 y1 = _mm256_i32gather_ps(sy + 1, k, 4);
+        __m256 nx0 = _mm256_i32gather_ps(snx, k, 4);
+        __m256 nx1 = _mm256_i32gather_ps(snx + 1, k, 4);
+        __m256 ny0 = _mm256_i32gather_ps(sny, k, 4);
+        __m256 ny1 = _mm256_i32gather_ps(sny + 1, k, 4);
+
+        __m256 o = _mm256_loadu_ps(offset + i);
+        __m256 px = _mm256_add_ps(x0, _mm256_mul_ps(_mm256_sub_ps(x1, x0), f));
+        __m256 py = _mm256_add_ps(y0, _mm256_mul_ps(_mm256_sub_ps(y1, y0), f));
+        __m256 nx = _mm256_add_ps(nx0, _mm256_mul_ps(_mm256_sub_ps(nx1, nx0), f));
+        __m256 ny = _mm256_add_ps(ny0, _mm256_mul_ps(_mm256_sub_ps(ny1, ny0), f));
+
+        _mm256_storeu_ps(x + i, _mm256_add_ps(px, _mm256_mul_ps(nx, o)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(py, _mm256_mul_ps(ny, o)));
+        _mm256_storeu_ps(distance + i, d);
+    }
+    return i;
+}
+
+// ============================================================
+// SSE2 kernel: 4 enemies per step (x86 CPUs without AVX2)
+// ============================================================
+static size_t EvaluateSSE2(const PathSamples& path, float* distance, const float* offset,
+                           float* x, float* y, size_t count)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lengthVec = _mm_set1_ps(path.length);
+    const __m128 invSpacingVec = _mm_set1_ps(path.invSpacing);
+    const int last = path.Count() - 2;
+    const float* sx = path.x.data();
+    const float* sy = path.y.data();
+    const float* snx = path.nx.data();
+    const float* sny = path.ny.data();
+
+    alignas(16) int lanes[4];
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 d = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(distance + i), zero), lengthVec);
+
+        __m128 s = _mm_mul_ps(d, invSpacingVec);
+        __m128i k = _mm_cvttps_epi32(s);
+
+        // No gather (or 32-bit min) in SSE2: clamp and load the four samples by index
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), k);
+        int k0 = std::min(lanes[0], last);
+        int k1 = std::min(lanes[1], last);
+        int k2 = std::min(lanes[2], last);
+        int k3 = std::min(lanes[3], last);
+        __m128 f = _mm_sub_ps(s, _mm_cvtepi32_ps(_mm_setr_epi32(k0, k1, k2, k3)));
+
+        __m128 x0 = _mm_setr_ps(sx[k0], sx[k1], sx[k2], sx[k3]);
+        __m128 x1 = _mm_setr_ps(sx[k0 + 1], sx[k1 + 1], sx[k2 + 1], sx[k3 + 1]);
+        __m128 y0 = _mm_setr_ps(sy[k0], sy[k1], sy[k2], sy[k3]);
+        __m128 y1 = _mm_setr_ps(sy[k0 + 1], sy[k1 + 1], sy[k2 + 1], sy[k3 + 1]);
+        __m128 nx0 = _mm_setr_ps(snx[k0], snx[k1], snx[k2], snx[k3]);
+        __m128 nx1 = _mm_setr_ps(snx[k0 + 1], snx[k1 + 1], snx[k2 + 1], snx[k3 + 1]);
+        __m128 ny0 = _mm_setr_ps(sny[k0], sny[k1], sny[k2], sny[k3]);
+        __m128 ny1 = _mm_setr_ps(sny[k0 + 1], sny[k1 + 1], sny[k2 + 1], sny[k3 + 1]);
+
+        __m128 o = _mm_loadu_ps(offset + i);
+        __m128 px = _mm_add_ps(x0, _mm_mul_ps(_mm_sub_ps(x1, x0), f));
+        __m128 py = _mm_add_ps(y0, _mm_mul_ps(_mm_sub_ps(y1, y0), f));
+        __m128 nx = _mm_add_ps(nx0, _mm_mul_ps(_mm_sub_ps(nx1, nx0), f));
+        __m128 ny = _mm_add_ps(ny0, _mm_mul_ps(_mm_sub_ps(ny1, ny0), f));
+
+        _mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(nx, o)));
+        _mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(ny, o)));
+        _mm_storeu_ps(distance + i, d);
+    }
+    return i;
+}
+
+using WideKernel = size_t (*)(const PathSamples&, float*, const float*, float*, float*, size_t);
+
+static WideKernel SelectKernel(const char** name)
+{
+    if (MathUtils::CpuHasAVX2()) {
+        *name = "AVX2";
+        return EvaluateAVX2;
+    }
+    *name = "SSE2";
+    return EvaluateSSE2;
+}
+
+#else
+
+using WideKernel = size_t (*)(const PathSamples&, float*, const float*, float*, float*, size_t);
+
+static size_t EvaluateNone(const PathSamples&, float*, const float*, float*, float*, size_t)
+{
+    return 0;
+}
+
+static WideKernel SelectKernel(const char** name)
+{
+    *name = "scalar";
+    return EvaluateNone;
+}
+
+#endif
+
+struct KernelChoice {
+    const char* name = nullptr;
+    WideKernel kernel = nullptr;
+
+    KernelChoice() { kernel = SelectKernel(&name); }
+};
+
+static const KernelChoice& GetKernel()
+{
+    static const KernelChoice choice;
+    return choice;
+}
+
+const char* GetKernelName()
+{
+    return GetKernel().name;
+}
+
+void Evaluate(const PathSamples& path, float* distance, const float* offset,
+              float* x, float* y, size_t count)
+{
+    if (path.Count() == 0 || count == 0) return;
+
+    size_t done = GetKernel().kernel(path, distance, offset, x, y, count);
+    EvaluateScalar(path, distance + done, offset + done, x + done, y + done, count - done);
+}
+
+} // namespace EnemyMovement
@@ -2,9 +2,30 @@
 #include "core/GameConfig.h"
 #include "systems/UISystem.h"
 #include "core/Game.h"
+#include "sim/BalanceRunner.h"
+#include "sim/AllocationCheck.h"
 
+#include <cstring>
 
-int main() {
+
+int main(int argc, char** argv) {
+
+    // Headless Monte Carlo balance runner (no window)
+    if (argc > 1 && std::strcmp(argv[1], "--balance") == 0) {
+        return BalanceRunner::RunFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // Headless zero-allocation check of the steady-state tick
+    if (argc > 1 && std::strcmp(argv[1], "--alloc-check") == 0) {
+        return AllocationCheck::RunFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // Windowed game on a tile-grid map file (see Map::LoadFromFile)
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--map=", 6) == 0) {
+            GetGameConfig().mapFile = argv[i] + 6;
+        }
+    }
 
     Game game;
     game.Run();
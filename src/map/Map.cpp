@@ -1,266 +1,711 @@
 #include "map/Map.h"
+#include "map/Path.h"
+#include "core/MemoryReport.h"
+#include "utils/Math.h"
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <unordered_map>
 
 Map::Map()
-    : gridWidth(0)
+    : residentChunks(0)
+    , frame(0)
+    , chunksX(0)
+    , chunksY(0)
+    , bakedChunks(0)
+    , textureBytes(0)
+    , pathVersion(1)
+    , gridWidth(0)
     , gridHeight(0)
-    , tileSize(64)
+    , tileSize(DEFAULT_TILE_SIZE)
     , offsetX(0)
     , offsetY(0)
     , spawnPoint{0, 0}
     , basePoint{0, 0}
+    , spawnTile(-1)
 {
 }
 
+Map::~Map() {
+    Clear();
+}
+
 void Map::Init(int screenWidth, int screenHeight) {
     // Calculate grid dimensions
-    tileSize = 64;
-    gridWidth = screenWidth / tileSize;
-    gridHeight = (screenHeight - 100) / tileSize;  // Leave space for UI at bottom
+    int size = DEFAULT_TILE_SIZE;
+    int width = screenWidth / size;
+    int height = (screenHeight - 100) / size;  // Leave space for UI at bottom
+    
+    // Water with scattered buildable areas (sand banks) inside the border
+    Reset(width, height, size, [width, height](int x, int y) {
+        bool interior = x >= 1 && x < width - 1 && y >= 1 && y < height - 1;
+        if (interior && ((x + y) % 3 == 0 || (x * y) % 5 == 0)) {
+            return TileType::EMPTY;
+        }
+        return TileType::WATER;
+    });
     
     // Center the map
     offsetX = (screenWidth - gridWidth * tileSize) / 2;
     offsetY = 50;  // Leave space at top for HUD
     
     CreateDefaultMap();
-    SetupPath();
+    ExtractPath();
 }
 
-void Map::CreateDefaultMap() {
-    // Clear existing tiles
-    tiles.clear();
-    tiles.resize(gridHeight);
-    
-    // Initialize all tiles as EMPTY (can place towers)
-    for (int y = 0; y < gridHeight; ++y) {
-        tiles[y].resize(gridWidth);
-        for (int x = 0; x < gridWidth; ++x) {
-            Rectangle bounds = {
-                static_cast<float>(offsetX + x * tileSize),
-                static_cast<float>(offsetY + y * tileSize),
-                static_cast<float>(tileSize),
-                static_cast<float>(tileSize)
-            };
-            
-            // Default to water background
-            tiles[y][x] = Tile(TileType::WATER, x, y, bounds);
-        }
-    }
+void Map::Reset(int width, int height, int size, TerrainFn generator) {
+    Clear();
     
-    // Create buildable areas (sand banks) - areas where towers can be placed
-    // These are areas alongside the path
-    for (int y = 1; y < gridHeight - 1; ++y) {
-        for (int x = 1; x < gridWidth - 1; ++x) {
-            // Create scattered buildable areas
-            if ((x + y) % 3 == 0 || (x * y) % 5 == 0) {
-                tiles[y][x] = Tile(TileType::EMPTY, x, y, tiles[y][x].bounds);
-            }
-        }
-    }
+    tileSize = size;
+    gridWidth = std::max(width, 0);
+    gridHeight = std::max(height, 0);
+    chunksX = (gridWidth + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunksY = (gridHeight + CHUNK_SIZE - 1) / CHUNK_SIZE;
     
+    // Directory only; chunks are created on first use
+    chunks.resize(static_cast<size_t>(chunksX) * chunksY);
+    terrain = std::move(generator);
+    spawnTile = -1;     // Terrain is never scanned for SPAWN: SetTile / LoadFromFile record it
+}
+
+void Map::CreateDefaultMap() {
     // Define path layout (snake pattern across the screen)
     // Path tiles: enemy walks on these
     int pathY = 4;  // Starting Y position
     
+    // Buildable bank beside the path (never over path tiles carved earlier)
+    auto bank = [this](int x, int y) {
+        if (GetTileAtGrid(x, y) != TileType::PATH) SetTile(x, y, TileType::EMPTY);
+    };
+    
     // Horizontal path from left
     for (int x = 0; x < 4; ++x) {
-        tiles[pathY][x] = Tile(TileType::PATH, x, pathY, tiles[pathY][x].bounds);
+        SetTile(x, pathY, TileType::PATH);
         // Make adjacent tiles buildable
-        if (pathY > 0) tiles[pathY-1][x] = Tile(TileType::EMPTY, x, pathY-1, tiles[pathY-1][x].bounds);
-        if (pathY < gridHeight-1) tiles[pathY+1][x] = Tile(TileType::EMPTY, x, pathY+1, tiles[pathY+1][x].bounds);
+        if (pathY > 0) bank(x, pathY-1);
+        if (pathY < gridHeight-1) bank(x, pathY+1);
     }
     
     // Down
     for (int y = pathY; y < pathY + 3 && y < gridHeight; ++y) {
-        tiles[y][3] = Tile(TileType::PATH, 3, y, tiles[y][3].bounds);
-        if (3 > 0) tiles[y][2] = Tile(TileType::EMPTY, 2, y, tiles[y][2].bounds);
-        if (3 < gridWidth-1) tiles[y][4] = Tile(TileType::EMPTY, 4, y, tiles[y][4].bounds);
+        SetTile(3, y, TileType::PATH);
+        if (3 > 0) bank(2, y);
+        if (3 < gridWidth-1) bank(4, y);
     }
     pathY += 2;
     
     // Right
     for (int x = 3; x < 8 && x < gridWidth; ++x) {
-        tiles[pathY][x] = Tile(TileType::PATH, x, pathY, tiles[pathY][x].bounds);
-        if (pathY > 0) tiles[pathY-1][x] = Tile(TileType::EMPTY, x, pathY-1, tiles[pathY-1][x].bounds);
-        if (pathY < gridHeight-1) tiles[pathY+1][x] = Tile(TileType::EMPTY, x, pathY+1, tiles[pathY+1][x].bounds);
+        SetTile(x, pathY, TileType::PATH);
+        if (pathY > 0) bank(x, pathY-1);
+        if (pathY < gridHeight-1) bank(x, pathY+1);
     }
     
     // Up
     for (int y = pathY; y > pathY - 4 && y >= 0; --y) {
-        tiles[y][7] = Tile(TileType::PATH, 7, y, tiles[y][7].bounds);
-        if (7 > 0) tiles[y][6] = Tile(TileType::EMPTY, 6, y, tiles[y][6].bounds);
-        if (7 < gridWidth-1) tiles[y][8] = Tile(TileType::EMPTY, 8, y, tiles[y][8].bounds);
+        SetTile(7, y, TileType::PATH);
+        if (7 > 0) bank(6, y);
+        if (7 < gridWidth-1) bank(8, y);
     }
     pathY -= 3;
     
     // Right
     for (int x = 7; x < 12 && x < gridWidth; ++x) {
-        tiles[pathY][x] = Tile(TileType::PATH, x, pathY, tiles[pathY][x].bounds);
-        if (pathY > 0) tiles[pathY-1][x] = Tile(TileType::EMPTY, x, pathY-1, tiles[pathY-1][x].bounds);
-        if (pathY < gridHeight-1) tiles[pathY+1][x] = Tile(TileType::EMPTY, x, pathY+1, tiles[pathY+1][x].bounds);
+        SetTile(x, pathY, TileType::PATH);
+        if (pathY > 0) bank(x, pathY-1);
+        if (pathY < gridHeight-1) bank(x, pathY+1);
     }
     
     // Down
     for (int y = pathY; y < pathY + 5 && y < gridHeight; ++y) {
-        tiles[y][11] = Tile(TileType::PATH, 11, y, tiles[y][11].bounds);
-        if (11 > 0) tiles[y][10] = Tile(TileType::EMPTY, 10, y, tiles[y][10].bounds);
-        if (11 < gridWidth-1) tiles[y][12] = Tile(TileType::EMPTY, 12, y, tiles[y][12].bounds);
+        SetTile(11, y, TileType::PATH);
+        if (11 > 0) bank(10, y);
+        if (11 < gridWidth-1) bank(12, y);
     }
     pathY += 4;
     
     // Right to end
     for (int x = 11; x < gridWidth; ++x) {
-        tiles[pathY][x] = Tile(TileType::PATH, x, pathY, tiles[pathY][x].bounds);
-        if (pathY > 0) tiles[pathY-1][x] = Tile(TileType::EMPTY, x, pathY-1, tiles[pathY-1][x].bounds);
-        if (pathY < gridHeight-1) tiles[pathY+1][x] = Tile(TileType::EMPTY, x, pathY+1, tiles[pathY+1][x].bounds);
+        SetTile(x, pathY, TileType::PATH);
+        if (pathY > 0) bank(x, pathY-1);
+        if (pathY < gridHeight-1) bank(x, pathY+1);
     }
     
     // Mark spawn and base
-    tiles[4][0] = Tile(TileType::SPAWN, 0, 4, tiles[4][0].bounds);
+    SetTile(0, 4, TileType::SPAWN);
     if (gridWidth > 0 && pathY < gridHeight) {
-        tiles[pathY][gridWidth-1] = Tile(TileType::BASE, gridWidth-1, pathY, tiles[pathY][gridWidth-1].bounds);
+        SetTile(gridWidth-1, pathY, TileType::BASE);
     }
 }
 
-void Map::SetupPath() {
+static bool IsWalkable(TileType type) {
+    return type == TileType::PATH || type == TileType::SPAWN || type == TileType::BASE;
+}
+
+bool Map::ExtractPath() {
     waypoints.clear();
+    spawnPoint = {0, 0};
+    basePoint = {0, 0};
+    OnPathChanged();
+    
+    // The spawn was recorded when it was set, so no scan of the map (or its chunks)
+    if (spawnTile < 0) return false;
+    int spawn = spawnTile;
+    
+    // Breadth-first over walkable tiles (4-connected) until the nearest base;
+    // on a branching layout this picks the shortest lane. Visited state is
+    // kept per reached tile, so only chunks along the path (and next to it) load.
+    static const int DX[4] = { 1, 0, -1, 0 };
+    static const int DY[4] = { 0, 1, 0, -1 };
+    
+    std::unordered_map<int, int> previous;
+    std::vector<int> frontier;
+    frontier.push_back(spawn);
+    previous.emplace(spawn, spawn);
+    
+    int base = -1;
+    for (size_t head = 0; head < frontier.size(); ++head) {
+        int cell = frontier[head];
+        int x = cell % gridWidth;
+        int y = cell / gridWidth;
+        if (GetTileAtGrid(x, y) == TileType::BASE) {
+            base = cell;
+            break;
+        }
+        
+        for (int d = 0; d < 4; ++d) {
+            int nx = x + DX[d];
+            int ny = y + DY[d];
+            if (!IsWalkable(GetTileAtGrid(nx, ny))) continue;   // BLOCKED outside the map
+            
+            int next = ny * gridWidth + nx;
+            if (previous.emplace(next, cell).second) {
+                frontier.push_back(next);
+            }
+        }
+    }
+    if (base < 0) return false;
+    
+    // Walk back from the base, then keep only the ends and the corners
+    std::vector<int> cells;
+    for (int cell = base; cell != spawn; cell = previous.at(cell)) {
+        cells.push_back(cell);
+    }
+    cells.push_back(spawn);
+    std::reverse(cells.begin(), cells.end());
+    
+    for (size_t i = 0; i < cells.size(); ++i) {
+        bool end = i == 0 || i + 1 == cells.size();
+        if (!end && cells[i] - cells[i - 1] == cells[i + 1] - cells[i]) continue;   // Collinear
+        waypoints.push_back(GetTileCenter(cells[i] % gridWidth, cells[i] / gridWidth));
+    }
     
-    // Create waypoints based on path tiles
-    // Follow the snake pattern
-    waypoints.push_back(GetTileCenter(0, 4));   // Start
-    waypoints.push_back(GetTileCenter(3, 4));   // First corner
-    waypoints.push_back(GetTileCenter(3, 6));   // Down
-    waypoints.push_back(GetTileCenter(7, 6));   // Right
-    waypoints.push_back(GetTileCenter(7, 3));   // Up
-    waypoints.push_back(GetTileCenter(11, 3));  // Right
-    waypoints.push_back(GetTileCenter(11, 7));  // Down
-    waypoints.push_back(GetTileCenter(gridWidth - 1, 7)); // End (base)
-    
-    // Set spawn and base points
     spawnPoint = waypoints.front();
     basePoint = waypoints.back();
+    OnPathChanged();
+    return true;
 }
 
-bool Map::LoadFromFile(const char* filename) {
-    // TODO: Implement file loading
-    (void)filename;
+void Map::OnPathChanged() {
+    // Coverage of loaded chunks is recomputed the next time it is queried
+    pathVersion++;
+    
+    // Same curve the enemies follow (PathSamples), for the mesh and for coverage
+    pathCurve.clear();
+    if (waypoints.size() >= 2) {
+        Path path;
+        path.SetWaypoints(waypoints);
+        path.Tessellate(PATH_MESH_SPACING, pathCurve);
+    }
+    BuildPathMesh();
+}
+
+void Map::BuildPathMesh() {
+    pathMesh.clear();
+    if (pathCurve.size() < 2) return;
+    
+    // A strip of left/right edge pairs along the curve
+    const std::vector<Vector2>& samples = pathCurve;
+    size_t count = samples.size();
+    float halfWidth = PATH_MESH_WIDTH * 0.5f;
+    pathMesh.resize(count * 2);
+    for (size_t i = 0; i < count; ++i) {
+        Vector2 tangent = MathUtils::Direction(samples[i > 0 ? i - 1 : 0], samples[std::min(i + 1, count - 1)]);
+        Vector2 normal = { tangent.y * halfWidth, -tangent.x * halfWidth };   // Keeps the strip counter-clockwise
+        pathMesh[i * 2] = { samples[i].x + normal.x, samples[i].y + normal.y };
+        pathMesh[i * 2 + 1] = { samples[i].x - normal.x, samples[i].y - normal.y };
+    }
+}
+
+// Length of segment a-b that lies inside the circle (center, radius)
+static float SegmentLengthInCircle(Vector2 a, Vector2 b, Vector2 center, float radius) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float fx = a.x - center.x;
+    float fy = a.y - center.y;
+    
+    float qa = dx * dx + dy * dy;
+    if (qa <= 0.0f) return 0.0f;
+    
+    float qb = 2.0f * (fx * dx + fy * dy);
+    float qc = fx * fx + fy * fy - radius * radius;
+    float disc = qb * qb - 4.0f * qa * qc;
+    if (disc <= 0.0f) return 0.0f;
+    
+    float root = std::sqrt(disc);
+    float t0 = std::max(0.0f, (-qb - root) / (2.0f * qa));
+    float t1 = std::min(1.0f, (-qb + root) / (2.0f * qa));
+    if (t1 <= t0) return 0.0f;
+    
+    return (t1 - t0) * std::sqrt(qa);
+}
+
+// ============================================================
+// Chunk directory
+// ============================================================
+
+int Map::ChunkIndex(int gridX, int gridY) const {
+    return (gridY / CHUNK_SIZE) * chunksX + gridX / CHUNK_SIZE;
+}
+
+Map::Chunk& Map::GetChunk(int chunkIndex) const {
+    std::unique_ptr<Chunk>& slot = chunks[chunkIndex];
+    if (!slot) {
+        slot = std::make_unique<Chunk>();
+        residentChunks++;
+        
+        // Generate the chunk's tiles (the part past the map edge is BLOCKED)
+        int baseX = (chunkIndex % chunksX) * CHUNK_SIZE;
+        int baseY = (chunkIndex / chunksX) * CHUNK_SIZE;
+        for (int ly = 0; ly < CHUNK_SIZE; ++ly) {
+            for (int lx = 0; lx < CHUNK_SIZE; ++lx) {
+                int x = baseX + lx;
+                int y = baseY + ly;
+                slot->tiles[ly * CHUNK_SIZE + lx] = IsInside(x, y) && terrain ? terrain(x, y) : TileType::BLOCKED;
+            }
+        }
+    }
+    slot->lastUsed = frame;
+    return *slot;
+}
+
+void Map::ComputeCoverage(int chunkIndex, Chunk& chunk) const {
+    std::fill(std::begin(chunk.coverage), std::end(chunk.coverage), static_cast<uint16_t>(0));
+    chunk.coverageVersion = pathVersion;
+    if (pathCurve.size() < 2) return;
+    
+    float ranges[TOWER_TYPE_COUNT];
+    for (int t = 0; t < TOWER_TYPE_COUNT; ++t) {
+        ranges[t] = GetTowerStats(static_cast<TowerType>(t)).range;
+    }
+    
+    int baseX = (chunkIndex % chunksX) * CHUNK_SIZE;
+    int baseY = (chunkIndex / chunksX) * CHUNK_SIZE;
+    for (int i = 0; i < CHUNK_TILES; ++i) {
+        if (chunk.tiles[i] != TileType::EMPTY) continue;
+        
+        Vector2 center = GetTileCenter(baseX + i % CHUNK_SIZE, baseY + i / CHUNK_SIZE);
+        uint16_t* entry = &chunk.coverage[i * TOWER_TYPE_COUNT];
+        
+        for (int t = 0; t < TOWER_TYPE_COUNT; ++t) {
+            // Along the smoothed curve enemies actually walk, not the waypoint polyline
+            float covered = 0.0f;
+            for (size_t w = 0; w + 1 < pathCurve.size(); ++w) {
+                covered += SegmentLengthInCircle(pathCurve[w], pathCurve[w + 1], center, ranges[t]);
+            }
+            float clamped = std::min(covered + 0.5f, static_cast<float>(std::numeric_limits<uint16_t>::max()));
+            entry[t] = static_cast<uint16_t>(clamped);
+        }
+    }
+}
+
+float Map::GetPathCoverage(int gridX, int gridY, TowerType type) const {
+    if (!IsInside(gridX, gridY)) {
+        return 0.0f;
+    }
+    int index = ChunkIndex(gridX, gridY);
+    Chunk& chunk = GetChunk(index);
+    if (chunk.coverageVersion != pathVersion) {
+        ComputeCoverage(index, chunk);
+    }
+    int local = (gridY % CHUNK_SIZE) * CHUNK_SIZE + gridX % CHUNK_SIZE;
+    return static_cast<float>(chunk.coverage[local * TOWER_TYPE_COUNT + static_cast<int>(type)]);
+}
+
+float Map::GetPathCoverageAt(Vector2 worldPos, TowerType type) const {
+    return GetPathCoverage(GridX(worldPos.x), GridY(worldPos.y), type);
+}
+
+static bool TileFromChar(char c, TileType& type) {
+    switch (c) {
+        case '.': type = TileType::EMPTY; return true;
+        case '#': type = TileType::PATH; return true;
+        case 'S': type = TileType::SPAWN; return true;
+        case 'B': type = TileType::BASE; return true;
+        case '~': type = TileType::WATER; return true;
+        case 'X': type = TileType::BLOCKED; return true;
+    }
     return false;
 }
 
-void Map::Draw() const {
-    // Draw all tiles
-    for (int y = 0; y < gridHeight; ++y) {
-        for (int x = 0; x < gridWidth; ++x) {
-            const Tile& tile = tiles[y][x];
+bool Map::LoadFromFile(const char* filename) {
+    std::ifstream file(filename);
+    if (!file) return false;
+    
+    std::vector<std::string> rows;
+    std::string line;
+    size_t width = 0;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        width = std::max(width, line.size());
+        rows.push_back(line);
+    }
+    while (!rows.empty() && rows.back().empty()) rows.pop_back();
+    if (rows.empty() || width == 0) return false;
+    
+    // The file is the terrain: chunks still load from it on demand
+    std::vector<TileType> grid(width * rows.size(), TileType::WATER);
+    int spawn = -1;
+    for (size_t y = 0; y < rows.size(); ++y) {
+        for (size_t x = 0; x < rows[y].size(); ++x) {
+            size_t index = y * width + x;
+            if (!TileFromChar(rows[y][x], grid[index])) return false;
+            if (grid[index] == TileType::SPAWN && spawn < 0) spawn = static_cast<int>(index);
+        }
+    }
+    
+    int gridW = static_cast<int>(width);
+    Reset(gridW, static_cast<int>(rows.size()), DEFAULT_TILE_SIZE,
+        [grid = std::move(grid), gridW](int x, int y) { return grid[static_cast<size_t>(y) * gridW + x]; });
+    offsetX = 0;
+    offsetY = 0;
+    spawnTile = spawn;
+    
+    return ExtractPath();
+}
+
+// ============================================================
+// Streaming: bake chunks near the view, evict under the budget
+// ============================================================
+
+void Map::StreamChunks(Rectangle view) {
+    frame++;
+    if (chunks.empty()) return;
+    
+    // Stamp everything in view first, so no chunk on screen looks least recently used
+    int vx0, vy0, vx1, vy1;
+    GetTileRange(view, vx0, vy0, vx1, vy1);
+    bool viewOnMap = vx1 >= 0 && vy1 >= 0;
+    if (viewOnMap) {
+        for (int cy = vy0 / CHUNK_SIZE; cy <= vy1 / CHUNK_SIZE; ++cy) {
+            for (int cx = vx0 / CHUNK_SIZE; cx <= vx1 / CHUNK_SIZE; ++cx) {
+                GetChunk(cy * chunksX + cx);
+            }
+        }
+    }
+    auto inView = [&](int index) {
+        int cx = index % chunksX;
+        int cy = index / chunksX;
+        return viewOnMap && cx >= vx0 / CHUNK_SIZE && cx <= vx1 / CHUNK_SIZE
+            && cy >= vy0 / CHUNK_SIZE && cy <= vy1 / CHUNK_SIZE;
+    };
+    
+    // Chunks in view first, then a one-chunk ring around it (prefetch while panning)
+    float chunkWorld = static_cast<float>(CHUNK_SIZE * tileSize);
+    Rectangle ring = { view.x - chunkWorld, view.y - chunkWorld,
+                       view.width + 2.0f * chunkWorld, view.height + 2.0f * chunkWorld };
+    Rectangle passes[2] = { view, ring };
+    
+    size_t chunkBytes = static_cast<size_t>(CHUNK_SIZE * tileSize) * (CHUNK_SIZE * tileSize) * 4;
+    int bakes = 0;
+    
+    for (const Rectangle& area : passes) {
+        int x0, y0, x1, y1;
+        GetTileRange(area, x0, y0, x1, y1);
+        // Past MAX_BAKES_PER_FRAME the rest draw per tile until later frames
+        for (int cy = y0 / CHUNK_SIZE; cy <= y1 / CHUNK_SIZE && y1 >= 0 && bakes < MAX_BAKES_PER_FRAME; ++cy) {
+            for (int cx = x0 / CHUNK_SIZE; cx <= x1 / CHUNK_SIZE && x1 >= 0 && bakes < MAX_BAKES_PER_FRAME; ++cx) {
+                int index = cy * chunksX + cx;
+                Chunk& chunk = GetChunk(index);
+                if (chunk.baked) continue;
+                
+                // Over budget: take the texture of the least recently viewed chunk off screen
+                if (chunk.texture.id == 0 && textureBytes + chunkBytes > TEXTURE_BUDGET_BYTES) {
+                    Chunk* oldest = nullptr;
+                    for (size_t i = 0; i < chunks.size(); ++i) {
+                        Chunk* other = chunks[i].get();
+                        if (other && other->texture.id != 0 && other->lastUsed < frame
+                            && !inView(static_cast<int>(i))
+                            && (!oldest || other->lastUsed < oldest->lastUsed)) {
+                            oldest = other;
+                        }
+                    }
+                    if (!oldest) continue;   // Everything baked is on screen: draw this one per tile
+                    chunk.texture = oldest->texture;   // Same size for every chunk: redraw it in place
+                    oldest->texture = RenderTexture2D{};
+                    oldest->baked = false;
+                }
+                BakeChunk(index, chunk);
+                bakes++;
+            }
+        }
+    }
+    
+    EvictChunks();
+}
+
+void Map::BakeChunk(int chunkIndex, Chunk& chunk) {
+    int pixels = CHUNK_SIZE * tileSize;
+    if (chunk.texture.id == 0) {
+        chunk.texture = LoadRenderTexture(pixels, pixels);
+        if (chunk.texture.id == 0) return;
+        textureBytes += static_cast<size_t>(pixels) * pixels * 4;
+        bakedChunks++;
+    }
+    
+    // Draw the chunk's tiles with its top-left corner at the texture origin
+    float baseX = static_cast<float>(offsetX + (chunkIndex % chunksX) * CHUNK_SIZE * tileSize);
+    float baseY = static_cast<float>(offsetY + (chunkIndex / chunksX) * CHUNK_SIZE * tileSize);
+    Camera2D local{};
+    local.target = {baseX, baseY};
+    local.zoom = 1.0f;
+    
+    BeginTextureMode(chunk.texture);
+    ClearBackground(BLANK);
+    BeginMode2D(local);
+    DrawChunkTiles(chunkIndex, chunk, GetWorldBounds());
+    EndMode2D();
+    EndTextureMode();
+    
+    chunk.baked = true;
+}
+
+void Map::UnbakeChunk(Chunk& chunk) {
+    if (chunk.texture.id != 0) {
+        if (IsWindowReady()) {
+            UnloadRenderTexture(chunk.texture);
+        }
+        int pixels = CHUNK_SIZE * tileSize;
+        textureBytes -= static_cast<size_t>(pixels) * pixels * 4;
+        bakedChunks--;
+        chunk.texture = RenderTexture2D{};
+    }
+    chunk.baked = false;
+}
+
+void Map::EvictChunks() {
+    if (residentChunks <= MAX_RESIDENT_CHUNKS) return;
+    
+    // Drop unedited, unbaked chunks not seen this frame; they regenerate on demand
+    for (auto& chunk : chunks) {
+        if (residentChunks <= MAX_RESIDENT_CHUNKS) break;
+        if (chunk && !chunk->edited && chunk->texture.id == 0 && chunk->lastUsed < frame) {
+            chunk.reset();
+            residentChunks--;
+        }
+    }
+}
+
+// ============================================================
+// Drawing
+// ============================================================
+
+static void DrawTile(TileType type, Rectangle bounds) {
+    // Draw tile background
+    DrawRectangleRec(bounds, GetTileColor(type));
+    
+    // Draw special markers
+    switch (type) {
+        case TileType::PATH:
+            // Draw path decoration (dots)
+            DrawCircle(
+                static_cast<int>(bounds.x + bounds.width / 2),
+                static_cast<int>(bounds.y + bounds.height / 2),
+                3.0f,
+                {100, 90, 80, 255}
+            );
+            break;
+            
+        case TileType::SPAWN:
+            // Draw spawn indicator
+            DrawText("S", 
+                static_cast<int>(bounds.x + bounds.width / 2 - 5),
+                static_cast<int>(bounds.y + bounds.height / 2 - 10),
+                20, PURPLE);
+            break;
+            
+        case TileType::BASE:
+            // Draw base indicator (Aria's location)
+            DrawText("A",
+                static_cast<int>(bounds.x + bounds.width / 2 - 5),
+                static_cast<int>(bounds.y + bounds.height / 2 - 10),
+                20, GOLD);
+            // Draw protective circle
+            DrawCircleLines(
+                static_cast<int>(bounds.x + bounds.width / 2),
+                static_cast<int>(bounds.y + bounds.height / 2),
+                25.0f, GOLD);
+            break;
             
-            // Draw tile background
-            DrawRectangleRec(tile.bounds, tile.color);
+        case TileType::EMPTY:
+            // Draw subtle grid pattern for buildable areas
+            DrawRectangleLinesEx(bounds, 1.0f, {40, 70, 100, 100});
+            break;
             
-            // Draw special markers
-            switch (tile.type) {
-                case TileType::PATH:
-                    // Draw path decoration (dots)
-                    DrawCircle(
-                        static_cast<int>(tile.bounds.x + tile.bounds.width / 2),
-                        static_cast<int>(tile.bounds.y + tile.bounds.height / 2),
-                        3.0f,
-                        {100, 90, 80, 255}
-                    );
-                    break;
-                    
-                case TileType::SPAWN:
-                    // Draw spawn indicator
-                    DrawText("S", 
-                        static_cast<int>(tile.bounds.x + tile.bounds.width / 2 - 5),
-                        static_cast<int>(tile.bounds.y + tile.bounds.height / 2 - 10),
-                        20, PURPLE);
-                    break;
-                    
-                case TileType::BASE:
-                    // Draw base indicator (Aria's location)
-                    DrawText("A",
-                        static_cast<int>(tile.bounds.x + tile.bounds.width / 2 - 5),
-                        static_cast<int>(tile.bounds.y + tile.bounds.height / 2 - 10),
-                        20, GOLD);
-                    // Draw protective circle
-                    DrawCircleLines(
-                        static_cast<int>(tile.bounds.x + tile.bounds.width / 2),
-                        static_cast<int>(tile.bounds.y + tile.bounds.height / 2),
-                        25.0f, GOLD);
-                    break;
-                    
-                case TileType::EMPTY:
-                    // Draw subtle grid pattern for buildable areas
-                    DrawRectangleLinesEx(tile.bounds, 1.0f, {40, 70, 100, 100});
-                    break;
-                    
-                default:
-                    break;
+        default:
+            break;
+    }
+}
+
+void Map::DrawChunkTiles(int chunkIndex, const Chunk& chunk, Rectangle view) const {
+    int baseX = (chunkIndex % chunksX) * CHUNK_SIZE;
+    int baseY = (chunkIndex / chunksX) * CHUNK_SIZE;
+    
+    int x0, y0, x1, y1;
+    GetTileRange(view, x0, y0, x1, y1);
+    x0 = std::max(x0, baseX);
+    y0 = std::max(y0, baseY);
+    x1 = std::min(x1, baseX + CHUNK_SIZE - 1);
+    y1 = std::min(y1, baseY + CHUNK_SIZE - 1);
+    
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            Rectangle bounds = {
+                static_cast<float>(offsetX + x * tileSize),
+                static_cast<float>(offsetY + y * tileSize),
+                static_cast<float>(tileSize),
+                static_cast<float>(tileSize)
+            };
+            DrawTile(chunk.tiles[(y - baseY) * CHUNK_SIZE + (x - baseX)], bounds);
+        }
+    }
+}
+
+void Map::Draw() const {
+    Draw(GetWorldBounds());
+}
+
+void Map::Draw(Rectangle view) const {
+    // One texture per baked chunk in view; the rest tile by tile
+    int x0, y0, x1, y1;
+    GetTileRange(view, x0, y0, x1, y1);
+    if (x1 >= x0 && y1 >= y0) {
+        float chunkWorld = static_cast<float>(CHUNK_SIZE * tileSize);
+        for (int cy = y0 / CHUNK_SIZE; cy <= y1 / CHUNK_SIZE; ++cy) {
+            for (int cx = x0 / CHUNK_SIZE; cx <= x1 / CHUNK_SIZE; ++cx) {
+                int index = cy * chunksX + cx;
+                const Chunk& chunk = GetChunk(index);
+                if (chunk.baked) {
+                    // Render textures are stored upside down
+                    Rectangle source = { 0.0f, 0.0f, chunkWorld, -chunkWorld };
+                    Rectangle dest = { offsetX + cx * chunkWorld, offsetY + cy * chunkWorld, chunkWorld, chunkWorld };
+                    DrawTexturePro(chunk.texture.texture, source, dest, {0, 0}, 0.0f, WHITE);
+                } else {
+                    DrawChunkTiles(index, chunk, view);
+                }
             }
         }
     }
     
-    // Draw path lines connecting waypoints
-    for (size_t i = 0; i < waypoints.size() - 1; ++i) {
-        DrawLineEx(waypoints[i], waypoints[i + 1], 3.0f, {120, 100, 80, 150});
+    // Path: the cached strip in one draw call
+    if (pathMesh.size() >= 4) {
+        DrawTriangleStrip(pathMesh.data(), static_cast<int>(pathMesh.size()), {120, 100, 80, 150});
     }
 }
 
 void Map::DrawGrid() const {
-    // Draw grid overlay (for debug/placement)
-    for (int y = 0; y <= gridHeight; ++y) {
+    DrawGrid(GetWorldBounds());
+}
+
+void Map::DrawGrid(Rectangle view) const {
+    // Draw grid overlay (for debug/placement), lines in view only
+    int x0, y0, x1, y1;
+    GetTileRange(view, x0, y0, x1, y1);
+    if (x1 < x0 || y1 < y0) return;
+    
+    for (int y = y0; y <= y1 + 1; ++y) {
         DrawLine(
-            offsetX, offsetY + y * tileSize,
-            offsetX + gridWidth * tileSize, offsetY + y * tileSize,
+            offsetX + x0 * tileSize, offsetY + y * tileSize,
+            offsetX + (x1 + 1) * tileSize, offsetY + y * tileSize,
             {255, 255, 255, 50}
         );
     }
-    for (int x = 0; x <= gridWidth; ++x) {
+    for (int x = x0; x <= x1 + 1; ++x) {
         DrawLine(
-            offsetX + x * tileSize, offsetY,
-            offsetX + x * tileSize, offsetY + gridHeight * tileSize,
+            offsetX + x * tileSize, offsetY + y0 * tileSize,
+            offsetX + x * tileSize, offsetY + (y1 + 1) * tileSize,
             {255, 255, 255, 50}
         );
     }
 }
 
-Tile* Map::GetTileAt(Vector2 worldPos) {
-    int gx = static_cast<int>((worldPos.x - offsetX) / tileSize);
-    int gy = static_cast<int>((worldPos.y - offsetY) / tileSize);
-    return GetTileAtGrid(gx, gy);
+Rectangle Map::GetWorldBounds() const {
+    return {
+        static_cast<float>(offsetX),
+        static_cast<float>(offsetY),
+        static_cast<float>(gridWidth * tileSize),
+        static_cast<float>(gridHeight * tileSize)
+    };
+}
+
+int Map::GridX(float worldX) const {
+    return static_cast<int>(std::floor((worldX - offsetX) / tileSize));
 }
 
-const Tile* Map::GetTileAt(Vector2 worldPos) const {
-    int gx = static_cast<int>((worldPos.x - offsetX) / tileSize);
-    int gy = static_cast<int>((worldPos.y - offsetY) / tileSize);
-    return GetTileAtGrid(gx, gy);
+int Map::GridY(float worldY) const {
+    return static_cast<int>(std::floor((worldY - offsetY) / tileSize));
 }
 
-Tile* Map::GetTileAtGrid(int gridX, int gridY) {
-    if (gridX < 0 || gridX >= gridWidth || gridY < 0 || gridY >= gridHeight) {
-        return nullptr;
+void Map::GetTileRange(Rectangle view, int& x0, int& y0, int& x1, int& y1) const {
+    x0 = std::max(GridX(view.x), 0);
+    y0 = std::max(GridY(view.y), 0);
+    x1 = std::min(GridX(view.x + view.width), gridWidth - 1);
+    y1 = std::min(GridY(view.y + view.height), gridHeight - 1);
+}
+
+bool Map::IsInside(int gridX, int gridY) const {
+    return gridX >= 0 && gridX < gridWidth && gridY >= 0 && gridY < gridHeight;
+}
+
+TileType Map::GetTileAt(Vector2 worldPos) const {
+    return GetTileAtGrid(GridX(worldPos.x), GridY(worldPos.y));
+}
+
+TileType Map::GetTileAtGrid(int gridX, int gridY) const {
+    if (!IsInside(gridX, gridY)) {
+        return TileType::BLOCKED;
     }
-    return &tiles[gridY][gridX];
+    const Chunk& chunk = GetChunk(ChunkIndex(gridX, gridY));
+    return chunk.tiles[(gridY % CHUNK_SIZE) * CHUNK_SIZE + gridX % CHUNK_SIZE];
 }
 
-const Tile* Map::GetTileAtGrid(int gridX, int gridY) const {
-    if (gridX < 0 || gridX >= gridWidth || gridY < 0 || gridY >= gridHeight) {
-        return nullptr;
+void Map::SetTile(int gridX, int gridY, TileType type) {
+    if (!IsInside(gridX, gridY)) return;
+    
+    Chunk& chunk = GetChunk(ChunkIndex(gridX, gridY));
+    chunk.tiles[(gridY % CHUNK_SIZE) * CHUNK_SIZE + gridX % CHUNK_SIZE] = type;
+    chunk.edited = true;
+    
+    int index = gridY * gridWidth + gridX;
+    if (type == TileType::SPAWN) {
+        spawnTile = index;
+    } else if (index == spawnTile) {
+        spawnTile = -1;
     }
-    return &tiles[gridY][gridX];
+    chunk.coverageVersion = 0;  // Recompute on next query
+    chunk.baked = false;        // Rebake (texture is reused) on next stream
 }
 
 bool Map::CanPlaceTower(Vector2 worldPos) const {
-    const Tile* tile = GetTileAt(worldPos);
-    if (!tile) return false;
-    
     // Can only place on EMPTY tiles
-    return tile->type == TileType::EMPTY;
+    return GetTileAt(worldPos) == TileType::EMPTY;
 }
 
 Vector2 Map::SnapToGrid(Vector2 worldPos) const {
-    int gx = static_cast<int>((worldPos.x - offsetX) / tileSize);
-    int gy = static_cast<int>((worldPos.y - offsetY) / tileSize);
+    int gx = GridX(worldPos.x);
+    int gy = GridY(worldPos.y);
     
     return GetTileCenter(gx, gy);
 }
@@ -273,8 +718,33 @@ Vector2 Map::GetTileCenter(int gridX, int gridY) const {
 }
 
 void Map::Clear() {
-    tiles.clear();
+    for (auto& chunk : chunks) {
+        if (chunk) UnbakeChunk(*chunk);
+    }
+    chunks.clear();
+    residentChunks = 0;
+    chunksX = 0;
+    chunksY = 0;
+    terrain = nullptr;
     waypoints.clear();
     gridWidth = 0;
     gridHeight = 0;
+    OnPathChanged();
+}
+
+// ============================================================
+// Memory
+// ============================================================
+void Map::ReportMemory(MemoryReport& report) const
+{
+    size_t resident = static_cast<size_t>(residentChunks);
+    size_t bytes = resident * sizeof(Chunk)
+        + MemoryReport::VectorBytes(chunks)
+        + MemoryReport::VectorBytes(waypoints)
+        + MemoryReport::VectorBytes(pathCurve)
+        + MemoryReport::VectorBytes(pathMesh);
+    report.Add("Map chunks", sizeof(Chunk), resident, chunks.size(), bytes);
+    
+    size_t chunkPixels = static_cast<size_t>(CHUNK_SIZE) * tileSize;
+    report.Add("Map textures", chunkPixels * chunkPixels * 4, static_cast<size_t>(bakedChunks), 0, textureBytes);
 }
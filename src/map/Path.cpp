@@ -1,19 +1,42 @@
 #include "map/Path.h"
+#include "utils/Math.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 Path::Path() {
 }
 
 void Path::SetWaypoints(const std::vector<Vector2>& points) {
     waypoints = points;
+    RebuildLengths();
 }
 
 void Path::AddWaypoint(Vector2 point) {
     waypoints.push_back(point);
+    
+    // Extend the table instead of rebuilding it
+    float length = 0.0f;
+    if (waypoints.size() > 1) {
+        length = cumulative.back() + MathUtils::Distance(waypoints[waypoints.size() - 2], point);
+    }
+    cumulative.push_back(length);
 }
 
 void Path::ClearWaypoints() {
     waypoints.clear();
+    cumulative.clear();
+}
+
+void Path::RebuildLengths() {
+    cumulative.resize(waypoints.size());
+    float total = 0.0f;
+    for (size_t i = 0; i < waypoints.size(); ++i) {
+        if (i > 0) {
+            total += MathUtils::Distance(waypoints[i - 1], waypoints[i]);
+        }
+        cumulative[i] = total;
+    }
 }
 
 Vector2 Path::GetWaypoint(int index) const {
@@ -33,46 +56,120 @@ Vector2 Path::GetEndPoint() const {
     return waypoints.back();
 }
 
-float Path::GetTotalLength() const {
-    if (waypoints.size() < 2) return 0.0f;
-    
-    float total = 0.0f;
-    for (size_t i = 0; i < waypoints.size() - 1; ++i) {
-        float dx = waypoints[i + 1].x - waypoints[i].x;
-        float dy = waypoints[i + 1].y - waypoints[i].y;
-        total += std::sqrt(dx * dx + dy * dy);
+float Path::GetDistanceToWaypoint(int index) const {
+    if (index < 0 || index >= static_cast<int>(cumulative.size())) {
+        return 0.0f;
     }
-    return total;
+    return cumulative[index];
 }
 
 Vector2 Path::GetPositionAlongPath(float t) const {
+    return GetPositionAtDistance(t * GetTotalLength());
+}
+
+int Path::GetSegmentAtDistance(float distance) const {
+    if (waypoints.size() < 2) return 0;
+    
+    // First waypoint strictly past the distance ends the segment
+    auto it = std::upper_bound(cumulative.begin(), cumulative.end(), distance);
+    int end = static_cast<int>(it - cumulative.begin());
+    return std::clamp(end - 1, 0, static_cast<int>(waypoints.size()) - 2);
+}
+
+Vector2 Path::GetPositionAtDistance(float distance) const {
     if (waypoints.empty()) return {0, 0};
     if (waypoints.size() == 1) return waypoints[0];
-    if (t <= 0.0f) return waypoints.front();
-    if (t >= 1.0f) return waypoints.back();
+    if (distance <= 0.0f) return waypoints.front();
+    if (distance >= GetTotalLength()) return waypoints.back();
     
-    float totalLength = GetTotalLength();
-    float targetDist = t * totalLength;
-    float currentDist = 0.0f;
+    int i = GetSegmentAtDistance(distance);
+    float segmentLength = cumulative[i + 1] - cumulative[i];
+    if (segmentLength <= 0.0f) return waypoints[i];
     
-    for (size_t i = 0; i < waypoints.size() - 1; ++i) {
-        float dx = waypoints[i + 1].x - waypoints[i].x;
-        float dy = waypoints[i + 1].y - waypoints[i].y;
-        float segmentLength = std::sqrt(dx * dx + dy * dy);
+    return MathUtils::Lerp(waypoints[i], waypoints[i + 1], (distance - cumulative[i]) / segmentLength);
+}
+
+float Path::GetDistanceOfPoint(Vector2 point) const {
+    if (waypoints.size() < 2) return 0.0f;
+    
+    int closest = 0;
+    float closestDistSq = std::numeric_limits<float>::max();
+    for (size_t i = 0; i + 1 < waypoints.size(); ++i) {
+        float distSq = MathUtils::SegmentDistanceSquared(point, waypoints[i], waypoints[i + 1]);
+        if (distSq < closestDistSq) {
+            closestDistSq = distSq;
+            closest = static_cast<int>(i);
+        }
+    }
+    return GetDistanceOfPoint(point, closest);
+}
+
+float Path::GetDistanceOfPoint(Vector2 point, int segment) const {
+    if (waypoints.size() < 2) return 0.0f;
+    segment = std::clamp(segment, 0, static_cast<int>(waypoints.size()) - 2);
+    
+    float t = 0.0f;
+    MathUtils::SegmentDistanceSquared(point, waypoints[segment], waypoints[segment + 1], &t);
+    return cumulative[segment] + t * (cumulative[segment + 1] - cumulative[segment]);
+}
+
+float Path::Tessellate(float spacing, std::vector<Vector2>& outSamples, float cornerRadius) const {
+    outSamples.clear();
+    if (waypoints.empty()) return 0.0f;
+    if (waypoints.size() == 1 || GetTotalLength() <= 0.0f) {
+        outSamples.assign(2, waypoints.front());
+        return 0.0f;
+    }
+    
+    // Control points: the waypoints, plus a point `cornerRadius` in from each end of
+    // every segment long enough, so the curve runs straight between corners and only
+    // bends within that radius of them
+    std::vector<Vector2> controls;
+    controls.reserve(waypoints.size() * 3);
+    for (size_t i = 0; i + 1 < waypoints.size(); ++i) {
+        Vector2 a = waypoints[i];
+        Vector2 b = waypoints[i + 1];
+        controls.push_back(a);
         
-        if (currentDist + segmentLength >= targetDist) {
-            // Target is on this segment
-            float segT = (targetDist - currentDist) / segmentLength;
-            return {
-                waypoints[i].x + dx * segT,
-                waypoints[i].y + dy * segT
-            };
+        float segmentLength = cumulative[i + 1] - cumulative[i];
+        if (cornerRadius > 0.0f && segmentLength > 2.0f * cornerRadius) {
+            float t = cornerRadius / segmentLength;
+            controls.push_back(MathUtils::Lerp(a, b, t));
+            controls.push_back(MathUtils::Lerp(a, b, 1.0f - t));
         }
+    }
+    controls.push_back(waypoints.back());
+    
+    // Dense walk along the curve (several points per output step), span by span;
+    // the missing neighbour at either end is the mirror of the next control point
+    const float denseStep = std::max(spacing * 0.25f, 0.25f);
+    Path dense;
+    dense.AddWaypoint(controls.front());
+    
+    size_t last = controls.size() - 1;
+    for (size_t i = 0; i < last; ++i) {
+        Vector2 p1 = controls[i];
+        Vector2 p2 = controls[i + 1];
+        Vector2 p0 = i > 0 ? controls[i - 1] : Vector2{2.0f * p1.x - p2.x, 2.0f * p1.y - p2.y};
+        Vector2 p3 = i + 1 < last ? controls[i + 2] : Vector2{2.0f * p2.x - p1.x, 2.0f * p2.y - p1.y};
         
-        currentDist += segmentLength;
+        int steps = std::max(static_cast<int>(std::ceil(MathUtils::Distance(p1, p2) / denseStep)), 1);
+        for (int s = 1; s <= steps; ++s) {
+            dense.AddWaypoint(MathUtils::CatmullRom(p0, p1, p2, p3, static_cast<float>(s) / steps));
+        }
     }
     
-    return waypoints.back();
+    // Resample at equal arc length; the step is adjusted so the last sample lands on the end
+    float length = dense.GetTotalLength();
+    int intervals = std::max(static_cast<int>(std::ceil(length / spacing)), 1);
+    float step = length / intervals;
+    
+    outSamples.resize(static_cast<size_t>(intervals) + 1);
+    for (int k = 0; k <= intervals; ++k) {
+        outSamples[k] = dense.GetPositionAtDistance(k * step);
+    }
+    outSamples.back() = waypoints.back();
+    return step;
 }
 
 void Path::Draw(Color color, float thickness) const {
@@ -0,0 +1,105 @@
+#include "sim/AllocationCheck.h"
+#include "sim/BalanceRunner.h"
+#include "sim/Simulation.h"
+#include "core/AllocationTracker.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace AllocationCheck {
+
+struct CheckConfig {
+    const char* mapFile = nullptr;
+    unsigned int seed = 1;
+    int budget = 300;
+    int warmupWaves = 1;            // Waves played before counting starts
+    float dt = 1.0f / 60.0f;
+    float maxSeconds = 1800.0f;
+};
+
+static int RunCheck(const CheckConfig& config)
+{
+    if (!AllocationTracker::IsEnabled()) {
+        std::fprintf(stderr, "alloc-check: build with GOTD_TRACK_ALLOCATIONS to enable tracking\n");
+        return 2;
+    }
+
+    auto sim = std::make_unique<Simulation>();
+    if (!sim->Init(config.seed, config.mapFile)) {
+        std::fprintf(stderr, "alloc-check: could not load map '%s'\n", config.mapFile);
+        return 1;
+    }
+
+    std::mt19937 layoutRng(config.seed);
+    std::vector<TowerPlacement> layout = BalanceRunner::SampleLayout(
+        BalanceRunner::GetBuildableTiles(sim->GetMap()), config.budget, layoutRng, &sim->GetMap());
+    for (const TowerPlacement& placement : layout) {
+        sim->PlaceTower(placement.type, placement.gridX, placement.gridY);
+    }
+
+    // Warm-up: let pools, the frame arena and wave bookkeeping reach steady state
+    WaveSystem& waves = sim->GetWaveSystem();
+    while (!sim->IsFinished() && waves.GetCurrentWave() <= config.warmupWaves
+        && sim->GetResult().simulatedTime < config.maxSeconds) {
+        sim->Step(config.dt);
+    }
+    int firstCheckedWave = waves.GetCurrentWave();
+
+    int ticks = 0;
+    AllocationTracker::Begin();
+    while (!sim->IsFinished() && sim->GetResult().simulatedTime < config.maxSeconds) {
+        sim->Step(config.dt);
+        ticks++;
+    }
+    AllocationTracker::End();
+
+    SimulationResult result = sim->GetResult();
+    AllocationStats total = AllocationTracker::GetTotal();
+    AllocationStats scopes[AllocationTracker::MAX_SCOPES];
+    int scopeCount = AllocationTracker::GetScopes(scopes, AllocationTracker::MAX_SCOPES);
+
+    std::printf("checked waves %d-%d: %d ticks, %s with %d HP\n",
+        firstCheckedWave, result.waveReached, ticks,
+        !sim->IsFinished() ? "timed out" : result.victory ? "victory" : "defeat", result.hpLeft);
+    std::printf("scope,allocations,frees,bytes\n");
+    for (int i = 0; i < scopeCount; ++i) {
+        std::printf("%s,%zu,%zu,%zu\n",
+            scopes[i].scope, scopes[i].allocations, scopes[i].frees, scopes[i].bytes);
+    }
+    std::printf("total,%zu,%zu,%zu\n", total.allocations, total.frees, total.bytes);
+
+    if (total.allocations > 0) {
+        std::printf("FAIL: %zu heap allocations during steady-state ticks\n", total.allocations);
+        return 1;
+    }
+    std::printf("PASS: no heap allocations during steady-state ticks\n");
+    return 0;
+}
+
+int RunFromCommandLine(int argc, char** argv)
+{
+    CheckConfig config;
+
+    for (int i = 0; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--seed=", 7) == 0) {
+            config.seed = static_cast<unsigned int>(std::strtoul(arg + 7, nullptr, 10));
+        } else if (std::strncmp(arg, "--budget=", 9) == 0) {
+            config.budget = std::atoi(arg + 9);
+        } else if (std::strncmp(arg, "--warmup=", 9) == 0) {
+            config.warmupWaves = std::atoi(arg + 9);
+        } else if (std::strncmp(arg, "--map=", 6) == 0) {
+            config.mapFile = arg + 6;
+        } else {
+            std::fprintf(stderr, "alloc-check: unknown option '%s'\n", arg);
+            return 1;
+        }
+    }
+
+    return RunCheck(config);
+}
+
+} // namespace AllocationCheck
@@ -0,0 +1,268 @@
+#include "sim/BalanceRunner.h"
+#include "sim/Simulation.h"
+#include "map/Map.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace BalanceRunner {
+
+std::vector<std::pair<int, int>> GetBuildableTiles(const Map& map)
+{
+    std::vector<std::pair<int, int>> tiles;
+    for (int y = 0; y < map.GetGridHeight(); ++y) {
+        for (int x = 0; x < map.GetGridWidth(); ++x) {
+            if (map.CanPlaceTower(map.GetTileCenter(x, y))) {
+                tiles.emplace_back(x, y);
+            }
+        }
+    }
+    return tiles;
+}
+
+std::vector<TowerPlacement> SampleLayout(
+    const std::vector<std::pair<int, int>>& tiles,
+    int budget,
+    std::mt19937& rng,
+    const Map* coverageMap)
+{
+    static constexpr TowerType allTypes[] = {
+        TowerType::CORAL_CANNON, TowerType::TIDAL_BURST, TowerType::FROST_TOTEM
+    };
+
+    std::vector<std::pair<int, int>> remainingTiles = tiles;
+    std::vector<TowerPlacement> layout;
+    std::vector<float> weights;
+    int remaining = budget;
+
+    while (!remainingTiles.empty()) {
+        // Pick uniformly among the tower types still affordable
+        TowerType affordable[3];
+        int affordableCount = 0;
+        for (TowerType type : allTypes) {
+            if (GetTowerStats(type).cost <= remaining) {
+                affordable[affordableCount++] = type;
+            }
+        }
+        if (affordableCount == 0) break;
+
+        std::uniform_int_distribution<int> pickType(0, affordableCount - 1);
+        TowerType type = affordable[pickType(rng)];
+
+        // Pick a free tile, weighted by precomputed coverage for this type if requested
+        size_t tileIndex = 0;
+        bool weighted = false;
+        if (coverageMap) {
+            weights.clear();
+            float total = 0.0f;
+            for (const auto& tile : remainingTiles) {
+                float w = coverageMap->GetPathCoverage(tile.first, tile.second, type);
+                weights.push_back(w);
+                total += w;
+            }
+            if (total > 0.0f) {
+                std::discrete_distribution<size_t> pickTile(weights.begin(), weights.end());
+                tileIndex = pickTile(rng);
+                weighted = true;
+            }
+        }
+        if (!weighted) {
+            std::uniform_int_distribution<size_t> pickTile(0, remainingTiles.size() - 1);
+            tileIndex = pickTile(rng);
+        }
+
+        std::pair<int, int> tile = remainingTiles[tileIndex];
+        remainingTiles[tileIndex] = remainingTiles.back();
+        remainingTiles.pop_back();
+
+        layout.push_back({ type, tile.first, tile.second });
+        remaining -= GetTowerStats(type).cost;
+    }
+
+    return layout;
+}
+
+static LayoutReport EvaluateLayout(
+    Simulation& sim,
+    const BalanceConfig& config,
+    const std::vector<TowerPlacement>& layout,
+    unsigned int firstSeed)
+{
+    LayoutReport report;
+    report.layout = layout;
+    for (const TowerPlacement& placement : layout) {
+        report.cost += GetTowerStats(placement.type).cost;
+    }
+
+    std::vector<int> hpLeft;
+    hpLeft.reserve(config.runsPerLayout);
+    float waveSum = 0.0f;
+
+    for (int run = 0; run < config.runsPerLayout; ++run) {
+        sim.Init(firstSeed + static_cast<unsigned int>(run), config.mapFile);
+        for (const TowerPlacement& placement : layout) {
+            sim.PlaceTower(placement.type, placement.gridX, placement.gridY);
+        }
+
+        SimulationResult result = sim.RunToEnd(config.dt, config.maxSeconds);
+        report.runs++;
+        waveSum += static_cast<float>(result.waveReached);
+
+        // A run that never ended is neither a win nor a loss
+        if (result.timedOut) {
+            report.timeouts++;
+            continue;
+        }
+        if (result.victory) report.wins++;
+        hpLeft.push_back(result.hpLeft);
+    }
+
+    if (report.runs > 0) {
+        report.meanWaveReached = waveSum / static_cast<float>(report.runs);
+    }
+    if (!hpLeft.empty()) {
+        std::sort(hpLeft.begin(), hpLeft.end());
+        int hpSum = 0;
+        for (int hp : hpLeft) hpSum += hp;
+
+        float finished = static_cast<float>(hpLeft.size());
+        report.winRate = static_cast<float>(report.wins) / finished;
+        report.meanHpLeft = static_cast<float>(hpSum) / finished;
+        report.minHpLeft = hpLeft.front();
+        report.medianHpLeft = hpLeft[hpLeft.size() / 2];
+        report.maxHpLeft = hpLeft.back();
+    }
+
+    return report;
+}
+
+std::vector<LayoutReport> Run(const BalanceConfig& config)
+{
+    // Build the map once to find candidate tiles
+    auto probe = std::make_unique<Simulation>();
+    if (!probe->Init(config.seed, config.mapFile)) {
+        std::fprintf(stderr, "balance: could not load map '%s'\n", config.mapFile);
+        return {};
+    }
+    std::vector<std::pair<int, int>> tiles = GetBuildableTiles(probe->GetMap());
+
+    // Sample all layouts up front so results don't depend on thread scheduling
+    std::mt19937 layoutRng(config.seed);
+    std::vector<std::vector<TowerPlacement>> layouts;
+    layouts.reserve(config.layoutCount);
+    for (int i = 0; i < config.layoutCount; ++i) {
+        layouts.push_back(SampleLayout(tiles, config.budget, layoutRng,
+            config.coverageWeighted ? &probe->GetMap() : nullptr));
+    }
+
+    std::vector<LayoutReport> reports(layouts.size());
+    std::atomic<int> nextLayout{ 0 };
+
+    int threadCount = config.threads > 0
+        ? config.threads
+        : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    threadCount = std::min(threadCount, std::max(1, static_cast<int>(layouts.size())));
+
+    auto worker = [&]() {
+        // One Simulation per thread, reused across runs
+        auto sim = std::make_unique<Simulation>();
+        for (;;) {
+            int index = nextLayout.fetch_add(1);
+            if (index >= static_cast<int>(layouts.size())) break;
+
+            unsigned int firstSeed = config.seed
+                + static_cast<unsigned int>(index * config.runsPerLayout);
+            reports[index] = EvaluateLayout(*sim, config, layouts[index], firstSeed);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threadCount; ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    return reports;
+}
+
+static char TowerLetter(TowerType type)
+{
+    switch (type) {
+        case TowerType::CORAL_CANNON: return 'C';
+        case TowerType::TIDAL_BURST: return 'T';
+        case TowerType::FROST_TOTEM: return 'F';
+        default: return '?';
+    }
+}
+
+void PrintReport(std::vector<LayoutReport> reports)
+{
+    std::stable_sort(reports.begin(), reports.end(),
+        [](const LayoutReport& a, const LayoutReport& b) {
+            if (a.winRate != b.winRate) return a.winRate > b.winRate;
+            return a.meanHpLeft > b.meanHpLeft;
+        });
+
+    std::printf("rank,win_rate,wins,runs,timeouts,hp_mean,hp_min,hp_median,hp_max,wave_mean,cost,layout\n");
+    int rank = 1;
+    for (const LayoutReport& report : reports) {
+        std::printf("%d,%.3f,%d,%d,%d,%.2f,%d,%d,%d,%.2f,%d,",
+            rank++, report.winRate, report.wins, report.runs, report.timeouts,
+            report.meanHpLeft, report.minHpLeft, report.medianHpLeft, report.maxHpLeft,
+            report.meanWaveReached, report.cost);
+        for (const TowerPlacement& placement : report.layout) {
+            std::printf("%c@%d:%d ", TowerLetter(placement.type), placement.gridX, placement.gridY);
+        }
+        std::printf("\n");
+    }
+}
+
+int RunFromCommandLine(int argc, char** argv)
+{
+    BalanceConfig config;
+
+    for (int i = 0; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--budget=", 9) == 0) {
+            config.budget = std::atoi(arg + 9);
+        } else if (std::strncmp(arg, "--layouts=", 10) == 0) {
+            config.layoutCount = std::atoi(arg + 10);
+        } else if (std::strncmp(arg, "--runs=", 7) == 0) {
+            config.runsPerLayout = std::atoi(arg + 7);
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            config.seed = static_cast<unsigned int>(std::strtoul(arg + 7, nullptr, 10));
+        } else if (std::strncmp(arg, "--threads=", 10) == 0) {
+            config.threads = std::atoi(arg + 10);
+        } else if (std::strncmp(arg, "--map=", 6) == 0) {
+            config.mapFile = arg + 6;
+        } else if (std::strcmp(arg, "--weighted") == 0) {
+            config.coverageWeighted = true;
+        } else {
+            std::fprintf(stderr, "balance: unknown option '%s'\n", arg);
+            return 1;
+        }
+    }
+
+    if (config.layoutCount <= 0 || config.runsPerLayout <= 0) {
+        std::fprintf(stderr, "balance: --layouts and --runs must be positive\n");
+        return 1;
+    }
+
+    std::vector<LayoutReport> reports = Run(config);
+    if (reports.empty()) {
+        return 1;
+    }
+
+    PrintReport(std::move(reports));
+    return 0;
+}
+
+} // namespace BalanceRunner
@@ -0,0 +1,119 @@
+#include "sim/Simulation.h"
+#include "core/GameConfig.h"
+#include "core/AllocationTracker.h"
+#include "core/GameRules.h"
+
+#include <algorithm>
+
+Simulation::Simulation()
+    : enemySystem(registry, events)
+    , waveSystem(events)
+    , towerSystem(registry, events)
+    , playerHP(MAX_HP)
+    , defeated(false)
+    , elapsed(0.0f)
+{
+    towerSystem.SetFrameAllocator(&frameArena);
+    ConnectSystems();
+}
+
+bool Simulation::Init(unsigned int seed, const char* mapFile)
+{
+    playerHP = MAX_HP;
+    defeated = false;
+    elapsed = 0.0f;
+
+    // Same map layout the windowed game builds for the configured screen
+    GameConfig& config = GetGameConfig();
+    gameMap.Init(config.screenWidth, config.screenHeight);
+    if (mapFile && !gameMap.LoadFromFile(mapFile)) {
+        return false;
+    }
+
+    enemySystem.Reset();
+    towerSystem.Reset();
+    waveSystem.Reset();
+    waveSystem.Init();
+    waveSystem.GetWaveManager().SetSeed(seed);
+
+    const std::vector<Vector2>& waypoints = gameMap.GetWaypoints();
+    enemySystem.SetWaypoints(waypoints);
+    if (!waypoints.empty()) {
+        waveSystem.GetWaveManager().SetSpawnPoint(waypoints[0]);
+    }
+
+    events.Clear();
+    return true;
+}
+
+void Simulation::ConnectSystems()
+{
+    // Same outcome rules as Game; no UI: boss warning and victory are read
+    // back from WaveManager state
+    GameRules::Connect(events, enemySystem, waveSystem, towerSystem, gameMap, playerHP);
+}
+
+bool Simulation::PlaceTower(TowerType type, int gridX, int gridY)
+{
+    Vector2 center = gameMap.GetTileCenter(gridX, gridY);
+    if (!gameMap.CanPlaceTower(center)) {
+        return false;
+    }
+    return towerSystem.GetManager().PlaceTower(type, center);
+}
+
+void Simulation::Step(float dt)
+{
+    if (IsFinished()) return;
+
+    elapsed += dt;
+
+    WaveManager& waves = waveSystem.GetWaveManager();
+    {
+        AllocationScope scope("WaveSystem");
+
+        // Start the next wave as soon as the field is clear
+        if (waves.CanStartNextWave()) {
+            waves.StartNextWave();
+        }
+        waveSystem.Update(dt);
+    }
+    {
+        AllocationScope scope("EnemySystem");
+        enemySystem.Update(dt);
+    }
+    {
+        AllocationScope scope("TowerSystem");
+        towerSystem.Update(dt, enemySystem.GetManager());
+    }
+    {
+        AllocationScope scope("Events");
+        events.Dispatch();
+    }
+    frameArena.Reset();
+
+    if (playerHP <= 0) {
+        defeated = true;
+    }
+}
+
+SimulationResult Simulation::RunToEnd(float dt, float maxSeconds)
+{
+    while (!IsFinished() && elapsed < maxSeconds) {
+        Step(dt);
+    }
+    
+    SimulationResult result = GetResult();
+    result.timedOut = !IsFinished();
+    return result;
+}
+
+SimulationResult Simulation::GetResult() const
+{
+    SimulationResult result;
+    result.victory = !defeated && waveSystem.IsVictory();
+    result.hpLeft = playerHP;
+    result.waveReached = waveSystem.GetCurrentWave();
+    result.simulatedTime = elapsed;
+    return result;
+}
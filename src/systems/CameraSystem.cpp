@@ -0,0 +1,94 @@
+#include "systems/CameraSystem.h"
+#include <algorithm>
+#include <cmath>
+
+CameraSystem::CameraSystem()
+    : camera{}
+    , worldBounds{0, 0, 0, 0}
+{
+    Reset();
+}
+
+void CameraSystem::SetWorldBounds(Rectangle bounds) {
+    worldBounds = bounds;
+    ClampToBounds();
+}
+
+void CameraSystem::Reset() {
+    camera.offset = {0, 0};
+    camera.target = {0, 0};
+    camera.rotation = 0.0f;
+    camera.zoom = 1.0f;
+}
+
+void CameraSystem::Update(float dt) {
+    // Keyboard pan (screen speed, so it feels the same at any zoom)
+    Vector2 pan = {0, 0};
+    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT))  pan.x -= 1.0f;
+    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) pan.x += 1.0f;
+    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP))    pan.y -= 1.0f;
+    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN))  pan.y += 1.0f;
+    
+    float step = PAN_SPEED * dt / camera.zoom;
+    camera.target.x += pan.x * step;
+    camera.target.y += pan.y * step;
+    
+    // Middle-mouse drag
+    if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)) {
+        Vector2 delta = GetMouseDelta();
+        camera.target.x -= delta.x / camera.zoom;
+        camera.target.y -= delta.y / camera.zoom;
+    }
+    
+    // Wheel zoom, keeping the world point under the cursor fixed
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f) {
+        Vector2 mouse = GetMousePosition();
+        Vector2 anchor = ScreenToWorld(mouse);
+        camera.offset = mouse;
+        camera.target = anchor;
+        camera.zoom = std::clamp(camera.zoom * std::pow(1.0f + ZOOM_STEP, wheel), MIN_ZOOM, MAX_ZOOM);
+    }
+    
+    if (IsKeyPressed(KEY_HOME)) {
+        Reset();
+    }
+    
+    ClampToBounds();
+}
+
+void CameraSystem::BeginWorld() const {
+    BeginMode2D(camera);
+}
+
+void CameraSystem::EndWorld() const {
+    EndMode2D();
+}
+
+Vector2 CameraSystem::ScreenToWorld(Vector2 screenPos) const {
+    return GetScreenToWorld2D(screenPos, camera);
+}
+
+Vector2 CameraSystem::WorldToScreen(Vector2 worldPos) const {
+    return GetWorldToScreen2D(worldPos, camera);
+}
+
+Rectangle CameraSystem::GetVisibleWorld() const {
+    Vector2 topLeft = ScreenToWorld({0, 0});
+    float width = static_cast<float>(GetScreenWidth()) / camera.zoom;
+    float height = static_cast<float>(GetScreenHeight()) / camera.zoom;
+    return {topLeft.x, topLeft.y, width, height};
+}
+
+void CameraSystem::ClampToBounds() {
+    if (worldBounds.width <= 0.0f || worldBounds.height <= 0.0f) return;
+    
+    // Shift the view so its centre stays over the world
+    Rectangle view = GetVisibleWorld();
+    float centerX = view.x + view.width * 0.5f;
+    float centerY = view.y + view.height * 0.5f;
+    float clampedX = std::clamp(centerX, worldBounds.x, worldBounds.x + worldBounds.width);
+    float clampedY = std::clamp(centerY, worldBounds.y, worldBounds.y + worldBounds.height);
+    camera.target.x += clampedX - centerX;
+    camera.target.y += clampedY - centerY;
+}
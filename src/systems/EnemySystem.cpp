@@ -1,33 +1,38 @@
 #include "systems/EnemySystem.h"
+#include "core/MemoryReport.h"
 
-// Sets the waypoint path used by all enemies.
-void EnemySystem::SetWaypoints(const std::vector<Vector2>& newWaypoints)
+EnemySystem::EnemySystem(Registry& registry, EventBus& events)
+    : manager(registry)
+    , events(events)
 {
-    waypoints = newWaypoints;
+    // Triggered when an enemy reaches the final waypoint (base/vault).
+    enemyEvents.onReachedEnd = [this]() {
+        reachedEndThisFrame++;
+        this->events.Publish(EnemyReachedBase{});
+        };
+
+    // Triggered when an enemy dies and gives a reward.
+    enemyEvents.onDeath = [this](const Enemy& enemy) {
+        manager.OnEnemyDied();
+        this->events.Publish(EnemyKilled{ enemy.reward, enemy.position, enemy.color });
+        };
 }
 
-// Connects the reward callback to an external system (money, demo, etc.)
-void EnemySystem::SetOnReward(std::function<void(int)> cb)
+// Sets the waypoint path used by all enemies.
+void EnemySystem::SetWaypoints(const std::vector<Vector2>& newWaypoints)
 {
-    onReward = std::move(cb);
+    waypoints = newWaypoints;
+    pathSamples.Build(waypoints);
+    manager.SetPath(&pathSamples);
 }
 
 // Spawns a new enemy and wires its events.
-void EnemySystem::SpawnEnemy(EnemyType type, Vector2 startPos)
+void EnemySystem::SpawnEnemy(EnemyType type, Vector2 startPos, float hpMultiplier)
 {
     Enemy e(type, startPos);
-
-    // Triggered when the enemy reaches the final waypoint (base/vault).
-    e.onReachedEnd = [this]() {
-        reachedEndThisFrame = true;
-        };
-
-    // Triggered when the enemy dies and gives a reward.
-    e.onDeath = [this](int reward) {
-        if (onReward) {
-            onReward(reward);
-        }
-        };
+    e.maxHp *= hpMultiplier;
+    e.hp = e.maxHp;
+    e.events = &enemyEvents;
 
     manager.AddEnemy(e);
 }
@@ -35,23 +40,24 @@ void EnemySystem::SpawnEnemy(EnemyType type, Vector2 startPos)
 // Updates all enemies and resets per-frame flags.
 void EnemySystem::Update(float dt)
 {
-    // Reset frame-based flag.
-    reachedEndThisFrame = false;
+    // Reset frame-based counter.
+    reachedEndThisFrame = 0;
 
-    // Update enemy manager (Enemy::Update handles empty waypoint list safely).
-    manager.Update(dt, waypoints);
+    // Update enemy manager: arrivals and removals only, positions are
+    // resolved when towers or drawing ask for them.
+    manager.Update(dt);
 }
 
 // Draws all enemies.
-void EnemySystem::Draw()
+void EnemySystem::Draw(Rectangle view)
 {
-    manager.Draw();
+    manager.Draw(view);
 }
 
 // Returns true if at least one enemy reached the end in this frame.
 bool EnemySystem::HasEnemyReachedEnd() const
 {
-    return reachedEndThisFrame;
+    return reachedEndThisFrame > 0;
 }
 
 // Returns true if there are no enemies alive.
@@ -64,5 +70,18 @@ bool EnemySystem::AreAllEnemiesDead() const
 void EnemySystem::Reset()
 {
     manager.Clear();
-    reachedEndThisFrame = false;
+    reachedEndThisFrame = 0;
+}
+
+void EnemySystem::ReportMemory(MemoryReport& report) const
+{
+    manager.ReportMemory(report);
+
+    // One path sample is a position and a normal
+    size_t bytes = MemoryReport::VectorBytes(waypoints)
+        + MemoryReport::VectorBytes(pathSamples.x)
+        + MemoryReport::VectorBytes(pathSamples.y)
+        + MemoryReport::VectorBytes(pathSamples.nx)
+        + MemoryReport::VectorBytes(pathSamples.ny);
+    report.Add("Enemy path", 4 * sizeof(float), pathSamples.x.size(), pathSamples.x.capacity(), bytes);
 }
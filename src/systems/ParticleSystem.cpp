@@ -0,0 +1,186 @@
+#include "systems/ParticleSystem.h"
+#include "core/MemoryReport.h"
+#include "utils/Simd.h"
+
+#include <algorithm>
+#include <cmath>
+
+ParticleSystem::ParticleSystem()
+    : count(0)
+    , dropped(0)
+    , rngState(0x9E3779B9u)
+{
+    posX.resize(MAX_PARTICLES);
+    posY.resize(MAX_PARTICLES);
+    velX.resize(MAX_PARTICLES);
+    velY.resize(MAX_PARTICLES);
+    life.resize(MAX_PARTICLES);
+    invLife.resize(MAX_PARTICLES);
+    size.resize(MAX_PARTICLES);
+    color.resize(MAX_PARTICLES);
+}
+
+void ParticleSystem::Clear()
+{
+    count = 0;
+    dropped = 0;
+}
+
+float ParticleSystem::Random()
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return static_cast<float>(rngState >> 8) * (1.0f / 16777216.0f);
+}
+
+// ============================================================
+// Emitters
+// ============================================================
+
+void ParticleSystem::EmitHit(Vector2 position, Color tint)
+{
+    Emit(position, tint, HIT_BURST, 0.0f);
+}
+
+void ParticleSystem::EmitSplash(Vector2 position, float radius, Color tint)
+{
+    // Start on a small ring and fly out over the splash area
+    Burst burst = SPLASH_BURST;
+    burst.maxSpeed = std::max(burst.maxSpeed, radius * 2.0f);
+    Emit(position, tint, burst, radius * 0.25f);
+}
+
+void ParticleSystem::EmitDeath(Vector2 position, Color tint)
+{
+    Emit(position, tint, DEATH_BURST, 0.0f);
+}
+
+size_t ParticleSystem::Allow(int requested)
+{
+    if (requested <= 0) return 0;
+    size_t want = static_cast<size_t>(requested);
+    
+    size_t allowed = want;
+    if (count >= MAX_PARTICLES) {
+        allowed = 0;
+    } else if (count > SOFT_LIMIT) {
+        // Linear falloff between the soft limit and capacity (at least one while there's room)
+        float scale = static_cast<float>(MAX_PARTICLES - count) / static_cast<float>(MAX_PARTICLES - SOFT_LIMIT);
+        allowed = std::max<size_t>(static_cast<size_t>(want * scale), 1);
+    }
+    allowed = std::min(allowed, MAX_PARTICLES - count);
+    
+    dropped += want - allowed;
+    return allowed;
+}
+
+void ParticleSystem::Emit(Vector2 position, Color tint, const Burst& burst, float ringRadius)
+{
+    size_t n = Allow(burst.count);
+    
+    for (size_t k = 0; k < n; ++k) {
+        // Evenly spread directions with a little jitter
+        float angle = (static_cast<float>(k) + Random() * 0.5f) * (2.0f * PI / static_cast<float>(n));
+        float dirX = std::cos(angle);
+        float dirY = std::sin(angle);
+        float speed = burst.minSpeed + (burst.maxSpeed - burst.minSpeed) * Random();
+        float seconds = burst.life * (0.75f + 0.5f * Random());
+        
+        size_t i = count++;
+        posX[i] = position.x + dirX * ringRadius;
+        posY[i] = position.y + dirY * ringRadius;
+        velX[i] = dirX * speed;
+        velY[i] = dirY * speed;
+        life[i] = seconds;
+        invLife[i] = 1.0f / seconds;
+        size[i] = burst.size;
+        color[i] = tint;
+    }
+}
+
+// ============================================================
+// Update
+// ============================================================
+
+void ParticleSystem::Update(float dt)
+{
+    if (count == 0) return;
+    
+    const float drag = std::exp(-DRAG * dt);
+    const float rise = BUOYANCY * dt;
+    
+    size_t i = 0;
+#if defined(GOTD_SIMD_X86)
+    // SSE2 only: every x86 build has it, so no run-time dispatch
+    const __m128 dtVec = _mm_set1_ps(dt);
+    const __m128 dragVec = _mm_set1_ps(drag);
+    const __m128 riseVec = _mm_set1_ps(rise);
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(&velX[i]);
+        __m128 vy = _mm_loadu_ps(&velY[i]);
+        _mm_storeu_ps(&posX[i], _mm_add_ps(_mm_loadu_ps(&posX[i]), _mm_mul_ps(vx, dtVec)));
+        _mm_storeu_ps(&posY[i], _mm_add_ps(_mm_loadu_ps(&posY[i]), _mm_mul_ps(vy, dtVec)));
+        _mm_storeu_ps(&velX[i], _mm_mul_ps(vx, dragVec));
+        _mm_storeu_ps(&velY[i], _mm_sub_ps(_mm_mul_ps(vy, dragVec), riseVec));
+        _mm_storeu_ps(&life[i], _mm_sub_ps(_mm_loadu_ps(&life[i]), dtVec));
+    }
+#endif
+    for (; i < count; ++i) {
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        velX[i] *= drag;
+        velY[i] = velY[i] * drag - rise;
+        life[i] -= dt;
+    }
+    
+    // Remove expired particles: the last live one takes each dead slot
+    i = 0;
+    while (i < count) {
+        if (life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        size_t last = --count;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        life[i] = life[last];
+        invLife[i] = invLife[last];
+        size[i] = size[last];
+        color[i] = color[last];
+    }
+}
+
+// ============================================================
+// Draw
+// ============================================================
+
+void ParticleSystem::Draw(Rectangle view) const
+{
+    // Same shape and texture throughout: raylib batches these into one draw call
+    float minX = view.x;
+    float minY = view.y;
+    float maxX = view.x + view.width;
+    float maxY = view.y + view.height;
+    
+    for (size_t i = 0; i < count; ++i) {
+        if (posX[i] < minX || posX[i] > maxX || posY[i] < minY || posY[i] > maxY) continue;
+        
+        float t = std::min(life[i] * invLife[i], 1.0f);   // 1 at birth, 0 at death
+        float side = size[i] * t;
+        Color c = color[i];
+        c.a = static_cast<unsigned char>(c.a * t);
+        DrawRectangleV({ posX[i] - side * 0.5f, posY[i] - side * 0.5f }, { side, side }, c);
+    }
+}
+
+void ParticleSystem::ReportMemory(MemoryReport& report) const
+{
+    size_t bytes = MemoryReport::VectorBytes(posX) + MemoryReport::VectorBytes(posY)
+        + MemoryReport::VectorBytes(velX) + MemoryReport::VectorBytes(velY)
+        + MemoryReport::VectorBytes(life) + MemoryReport::VectorBytes(invLife)
+        + MemoryReport::VectorBytes(size) + MemoryReport::VectorBytes(color);
+    report.Add("Particles", 7 * sizeof(float) + sizeof(Color), count, MAX_PARTICLES, bytes);
+}
@@ -1,45 +1,69 @@
 #include "systems/TowerSystem.h"
+#include "tower/TargetingPolicy.h"
+#include "core/MemoryReport.h"
+#include "utils/Math.h"
 #include <cmath>
 #include <algorithm>
 #include <limits>
 
-TowerSystem::TowerSystem()
-    : selectedType(TowerType::CORAL_CANNON)
+TowerSystem::TowerSystem(Registry& registry, EventBus& events)
+    : manager(registry)
+    , selectedType(TowerType::CORAL_CANNON)
     , previewPos{0, 0}
     , previewActive(false)
     , currentEnemies(nullptr)
+    , enemyPool(registry.Pool<Enemy>())
+    , coverageLayoutVersion(0)
+    , coveragePathVersion(0)
+    , coverageShrinkPending(false)
+    , events(events)
 {
+    enemyX.reserve(INITIAL_ENEMY_CAPACITY);
+    enemyY.reserve(INITIAL_ENEMY_CAPACITY);
+    enemyIndex.reserve(INITIAL_ENEMY_CAPACITY);
+    queryHits.reserve(INITIAL_ENEMY_CAPACITY);
+    enemyGrid.Reserve(INITIAL_ENEMY_CAPACITY);
+    
     // Set up projectile hit callback
     manager.SetOnProjectileHit(
-        [this](Projectile& proj, Vector2 hitPos) {
+        [this](Projectile& proj, Vector2 sweepStart, Vector2 hitPos) {
             if (currentEnemies) {
-                HandleProjectileHit(proj, hitPos, *currentEnemies);
+                HandleProjectileHit(proj, sweepStart, hitPos, currentEnemies->GetEnemies());
             }
         }
     );
 }
 
-void TowerSystem::Update(float dt, std::vector<Enemy>& enemies) {
-    currentEnemies = &enemies;
+void TowerSystem::Update(float dt, EnemyManager& enemyManager) {
+    currentEnemies = &enemyManager;
+    std::vector<Enemy>& enemies = enemyManager.GetEnemies();
+    
+    // Enemies don't move during this update, so one snapshot serves every query.
+    // Only enemies within reach of a tower are evaluated; with nothing on the
+    // field to look at them, none are.
+    if (manager.GetTowerCount() > 0 || manager.GetProjectileCount() > 0) {
+        UpdateTowerCoverage(enemyManager);
+        enemyManager.ResolvePositions(towerCoverage);
+        SnapshotEnemyPositions(enemyManager);
+    }
     
     // Update tower manager (handles cooldowns and projectiles)
     manager.Update(dt);
     
-    // For each tower, find target and fire if ready
-    for (auto& tower : manager.GetTowers()) {
-        if (!tower.CanFire()) continue;
+    // Towers whose cooldown has run out: find target and fire
+    manager.ForEachReadyTower([&](Tower& tower) {
+        Enemy* target = AcquireTarget(tower, enemies);
+        if (!target || !target->alive) return false;
         
-        Enemy* target = FindTarget(tower, enemies);
-        if (target && target->alive) {
-            // Fire projectile at target
-            Projectile proj = tower.Fire(target->position);
-            manager.AddProjectile(proj);
-        }
-    }
+        // Fire projectile at target
+        Projectile proj = tower.Fire(target->position);
+        manager.AddProjectile(proj);
+        return true;
+    });
 }
 
-void TowerSystem::Draw() const {
-    manager.Draw();
+void TowerSystem::Draw(Rectangle view) const {
+    manager.Draw(view);
     
     if (previewActive) {
         DrawPreview();
@@ -98,10 +122,58 @@ Tower* TowerSystem::GetSelectedTower() const {
     return manager.GetSelectedTower();
 }
 
+bool TowerSystem::TryUpgradeSelected() {
+    Tower* tower = manager.GetSelectedTower();
+    if (!tower || !tower->CanUpgrade()) {
+        return false;
+    }
+    
+    // Spend gold
+    if (onSpendGold && !onSpendGold(tower->GetUpgradeCost())) {
+        return false;
+    }
+    
+    if (!tower->Upgrade()) {
+        return false;
+    }
+    manager.OnTowerUpgraded(tower);
+    return true;
+}
+
+bool TowerSystem::CycleSelectedTargeting() {
+    Tower* tower = manager.GetSelectedTower();
+    if (!tower) {
+        return false;
+    }
+    
+    tower->CycleTargetingMode();
+    return true;
+}
+
+bool TowerSystem::SellSelected() {
+    Tower* tower = manager.GetSelectedTower();
+    if (!tower) {
+        return false;
+    }
+    
+    TowerType type = tower->GetType();
+    int refund = tower->GetSellValue();
+    if (!manager.RemoveTower(tower->GetPosition())) {
+        return false;
+    }
+    
+    events.Publish(TowerSold{ type, refund });
+    return true;
+}
+
 void TowerSystem::SetCanPlaceAt(std::function<bool(Vector2)> callback) {
     canPlaceAt = std::move(callback);
 }
 
+void TowerSystem::SetPathCoverageQuery(std::function<float(Vector2, TowerType)> callback) {
+    pathCoverageAt = std::move(callback);
+}
+
 void TowerSystem::SetOnSpendGold(std::function<bool(int)> callback) {
     onSpendGold = std::move(callback);
 }
@@ -113,7 +185,7 @@ int TowerSystem::GetTowerCost(TowerType type) {
 void TowerSystem::DrawPreview() const {
     if (!previewActive) return;
     
-    TowerStats stats = GetTowerStats(selectedType);
+    const TowerStats& stats = GetTowerStats(selectedType);
     bool canPlace = (!canPlaceAt || canPlaceAt(previewPos)) && 
                     !manager.HasTowerAt(previewPos, 40.0f);
     
@@ -125,79 +197,152 @@ void TowerSystem::DrawPreview() const {
     
     // Draw tower preview
     DrawCircle((int)previewPos.x, (int)previewPos.y, 20.0f, previewColor);
+    
+    // Show how much path this spot covers
+    if (canPlace && pathCoverageAt) {
+        float coverage = pathCoverageAt(previewPos, selectedType);
+        DrawText(TextFormat("Path: %dpx", (int)coverage),
+            (int)previewPos.x + 24, (int)previewPos.y - 8, 16, WHITE);
+    }
 }
 
-Enemy* TowerSystem::FindTarget(Tower& tower, std::vector<Enemy>& enemies) {
-    Enemy* bestTarget = nullptr;
-    float bestPriority = -std::numeric_limits<float>::max();
+void TowerSystem::UpdateTowerCoverage(const EnemyManager& enemyManager) {
+    const PathSamples* path = enemyManager.GetPath();
+    if (!path) return;
     
-    for (auto& enemy : enemies) {
-        if (!enemy.alive) continue;
-        
-        // Check if in range
-        if (!tower.IsInRange(enemy.position)) continue;
-        
-        // Priority: closest to end (highest waypoint index) and closest to tower
-        // This makes towers focus on enemies that are closest to reaching the base
-        float priority = static_cast<float>(enemy.currentWaypointIndex) * 1000.0f 
-                        - tower.GetDistanceTo(enemy.position);
-        
-        if (priority > bestPriority) {
-            bestPriority = priority;
-            bestTarget = &enemy;
-        }
+    bool layoutChanged = manager.GetLayoutVersion() != coverageLayoutVersion;
+    bool pathChanged = enemyManager.GetPathVersion() != coveragePathVersion;
+    bool canShrink = coverageShrinkPending && manager.GetProjectileCount() == 0;
+    if (!layoutChanged && !pathChanged && !canShrink) return;
+    
+    // Projectiles of a sold tower still land where it stood: keep the old
+    // stretches until they are gone (the path itself moving drops them)
+    bool keepOld = !pathChanged && manager.GetProjectileCount() > 0;
+    if (!keepOld) {
+        towerCoverage.Clear();
+    }
+    coverageShrinkPending = keepOld;
+    
+    for (const Tower& tower : manager.GetTowers()) {
+        float reach = tower.GetRange() + std::max(tower.GetSplashRadius(), SINGLE_HIT_RADIUS)
+            + EnemyManager::MAX_LANE_OFFSET;
+        path->AddRangesNear(tower.GetPosition(), reach, towerCoverage);
     }
+    towerCoverage.Normalize();
+    coverageLayoutVersion = manager.GetLayoutVersion();
+    coveragePathVersion = enemyManager.GetPathVersion();
+}
+
+void TowerSystem::SnapshotEnemyPositions(const EnemyManager& enemyManager) {
+    const std::vector<Enemy>& enemies = enemyManager.GetEnemies();
+    enemyX.resize(enemies.size());
+    enemyY.resize(enemies.size());
+    enemyIndex.resize(enemies.size());
+    queryHits.resize(enemies.size());
     
-    return bestTarget;
+    size_t count = 0;
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        if (!enemyManager.IsPositionCurrent(enemies[i])) continue;   // Out of every tower's reach
+        enemyX[count] = enemies[i].position.x;
+        enemyY[count] = enemies[i].position.y;
+        enemyIndex[count] = static_cast<int>(i);
+        count++;
+    }
+    enemyGrid.Build(enemyX.data(), enemyY.data(), count);
 }
 
-void TowerSystem::HandleProjectileHit(Projectile& proj, Vector2 hitPos, std::vector<Enemy>& enemies) {
+void TowerSystem::RemapHits(size_t count) {
+    for (size_t h = 0; h < count; ++h) {
+        queryHits[h] = enemyIndex[queryHits[h]];
+    }
+}
+
+Enemy* TowerSystem::AcquireTarget(Tower& tower, std::vector<Enemy>& enemies) {
+    // Sticky target still good: no scan
+    Enemy* current = enemyPool.TryGet(tower.GetTarget());
+    if (current && current->alive && currentEnemies->IsPositionCurrent(*current)
+        && tower.IsInRange(current->position)
+        && tower.GetShotsAtTarget() < RESCAN_SHOTS) {
+        return current;
+    }
+    
+    Enemy* found = FindTarget(tower, enemies);
+    tower.SetTarget(found ? enemyPool.EntityOf(found) : Entity{});
+    return found;
+}
+
+Enemy* TowerSystem::FindTarget(Tower& tower, std::vector<Enemy>& enemies) {
+    // Range test over the grid cells the range touches (a miss far from the
+    // enemies costs a few empty cells), then the targeting policy picks
+    size_t hitCount = enemyGrid.QueryRadius(tower.GetPosition(), tower.GetRange(),
+        queryHits.data(), queryHits.size());
+    RemapHits(hitCount);
+    
+    return Targeting::SelectTarget(tower.GetTargetingMode(), tower.GetPosition(),
+        enemies, queryHits.data(), hitCount);
+}
+
+void TowerSystem::HandleProjectileHit(Projectile& proj, Vector2 sweepStart, Vector2 hitPos, std::vector<Enemy>& enemies) {
     // Handle splash damage
     if (proj.splashRadius > 0.0f) {
-        // AoE damage
-        for (auto& enemy : enemies) {
+        // AoE damage to every enemy inside the splash circle
+        size_t hitCount = enemyGrid.QueryRadius(hitPos, proj.splashRadius,
+            queryHits.data(), queryHits.size());
+        RemapHits(hitCount);
+        
+        for (size_t h = 0; h < hitCount; ++h) {
+            Enemy& enemy = enemies[queryHits[h]];
             if (!enemy.alive) continue;
             
-            float dx = enemy.position.x - hitPos.x;
-            float dy = enemy.position.y - hitPos.y;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            
-            if (dist <= proj.splashRadius) {
-                // Damage falls off with distance
-                float falloff = 1.0f - (dist / proj.splashRadius) * 0.5f;
-                enemy.TakeDamage(proj.damage * falloff);
-            }
+            // Damage falls off with distance
+            float dist = MathUtils::Distance(hitPos, enemy.position);
+            float falloff = 1.0f - (dist / proj.splashRadius) * 0.5f;
+            enemy.TakeDamage(proj.damage * falloff);
         }
         
-        // Draw splash effect (visual feedback)
-        // Note: This is instant, for proper effects you'd use a particle system
+        // Visual feedback (particles) is up to whoever subscribes
+        events.Publish(ProjectileImpact{ hitPos, proj.splashRadius, proj.color });
     } else {
-        // Single target - find closest enemy to hit position
+        // Single target - swept: the first enemy the projectile passed within
+        // SINGLE_HIT_RADIUS of during this update (ties go to the closer one)
         Enemy* target = nullptr;
-        float closestDist = 30.0f; // Max distance to consider a hit
+        float firstT = 2.0f;
+        float closestDistSq = 0.0f;
         
-        for (auto& enemy : enemies) {
+        size_t hitCount = enemyGrid.QuerySegment(sweepStart, hitPos, SINGLE_HIT_RADIUS, queryHits.data());
+        RemapHits(hitCount);
+        
+        for (size_t h = 0; h < hitCount; ++h) {
+            Enemy& enemy = enemies[queryHits[h]];
             if (!enemy.alive) continue;
             
-            float dx = enemy.position.x - hitPos.x;
-            float dy = enemy.position.y - hitPos.y;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            
-            if (dist < closestDist) {
-                closestDist = dist;
+            float t;
+            float distSq = MathUtils::SegmentDistanceSquared(enemy.position, sweepStart, hitPos, &t);
+            if (t < firstT || (t == firstT && distSq < closestDistSq)) {
+                firstT = t;
+                closestDistSq = distSq;
                 target = &enemy;
             }
         }
         
         if (target) {
+            events.Publish(ProjectileImpact{ target->position, 0.0f, proj.color });
             target->TakeDamage(proj.damage);
             
-            // Apply slow effect
-            if (proj.slowAmount > 0.0f) {
-                // Reduce enemy speed temporarily
-                // Note: For proper slow, you'd add slow state to Enemy
-                target->speed *= (1.0f - proj.slowAmount);
+            // Slow for the projectile's duration (re-bases path distance and arrival)
+            if (proj.slowAmount > 0.0f && currentEnemies) {
+                currentEnemies->ApplySlow(*target, proj.slowAmount, proj.slowDuration);
             }
         }
     }
 }
+
+void TowerSystem::ReportMemory(MemoryReport& report) const {
+    manager.ReportMemory(report);
+    
+    // Per enemy: x, y, its enemy index and a query result slot
+    size_t bytes = MemoryReport::VectorBytes(enemyX) + MemoryReport::VectorBytes(enemyY)
+        + MemoryReport::VectorBytes(enemyIndex) + MemoryReport::VectorBytes(queryHits)
+        + MemoryReport::VectorBytes(towerCoverage.ranges) + enemyGrid.MemoryBytes();
+    report.Add("Targeting", 2 * sizeof(float) + 2 * sizeof(int), enemyX.size(), enemyX.capacity(), bytes);
+}
@@ -1,6 +1,8 @@
 #include "systems/UISystem.h"
 #include "ui/HUD.h"
 #include "ui/Screens.h"
+#include "core/MemoryReport.h"
+#include <cstdio>
 
 UISystem::UISystem()
     : currentScreen(UIScreenState::PlayingHUD) {
@@ -28,9 +30,9 @@ void UISystem::Update(float dt) {
     }
 }
 
-void UISystem::ShowStory(const std::string& line1, const std::string& line2, float durationSeconds) {
-    story.line1 = line1;
-    story.line2 = line2;
+void UISystem::ShowStory(const char* line1, const char* line2, float durationSeconds) {
+    std::snprintf(story.line1, sizeof(story.line1), "%s", line1 ? line1 : "");
+    std::snprintf(story.line2, sizeof(story.line2), "%s", line2 ? line2 : "");
     story.duration = durationSeconds;
     story.timer = durationSeconds;
     story.active = true;
@@ -62,11 +64,11 @@ void UISystem::DrawStoryBanner() {
     const float spacing = 2.0f;
 
     Vector2 p1 = { 40, 25 };
-    DrawTextEx(fonts.uiFont, story.line1.c_str(), p1, titleSize, spacing, accent);
+    DrawTextEx(fonts.uiFont, story.line1, p1, titleSize, spacing, accent);
 
-    if (!story.line2.empty()) {
+    if (story.line2[0] != '\0') {
         Vector2 p2 = { 40, 70 };
-        DrawTextEx(fonts.uiFont, story.line2.c_str(), p2, bodySize, spacing, textCol);
+        DrawTextEx(fonts.uiFont, story.line2, p2, bodySize, spacing, textCol);
     }
 }
 
@@ -98,3 +100,14 @@ void UISystem::Draw() {
         break;
     }
 }
+
+void UISystem::ReportMemory(MemoryReport& report) const {
+    // Satırlar sabit tamponlarda; dolu olanlar "live" sayılır
+    size_t usedLines = (story.line1[0] != '\0' ? 1 : 0) + (story.line2[0] != '\0' ? 1 : 0);
+    report.Add("UI strings", StoryBanner::LINE_CAPACITY, usedLines, 2, sizeof(story.line1) + sizeof(story.line2));
+
+    // Varsayılan raylib fontu sayılmaz (raylib'in kendi belleği)
+    const FontResources& fonts = GetFontResources();
+    size_t fontBytes = fonts.loaded ? MemoryReport::FontBytes(fonts.uiFont) : 0;
+    report.Add("Fonts", 0, fonts.loaded ? 1 : 0, 1, fontBytes);
+}
@@ -0,0 +1,26 @@
+#include "tower/TargetingPolicy.h"
+
+namespace Targeting {
+
+using SelectFn = Enemy* (*)(Vector2, std::vector<Enemy>&, const int*, size_t);
+
+// Indexed by TargetingMode
+static constexpr SelectFn SELECTORS[] = {
+    SelectTarget<First>,
+    SelectTarget<Last>,
+    SelectTarget<Strongest>,
+    SelectTarget<Weakest>,
+    SelectTarget<Closest>,
+    SelectTarget<Fastest>,
+};
+
+static_assert(sizeof(SELECTORS) / sizeof(SELECTORS[0]) == TARGETING_MODE_COUNT,
+              "SELECTORS needs exactly one entry per TargetingMode");
+
+Enemy* SelectTarget(TargetingMode mode, Vector2 towerPos, std::vector<Enemy>& enemies,
+                    const int* candidates, size_t count)
+{
+    return SELECTORS[static_cast<int>(mode)](towerPos, enemies, candidates, count);
+}
+
+} // namespace Targeting
@@ -1,10 +1,30 @@
 #include "tower/Tower.h"
 #include <cmath>
 
+// Per-type visuals, indexed by TowerType like TOWER_TYPES
+struct TowerVisuals {
+    float radius;
+    Color baseColor;
+    Color accentColor;
+    Color projectileColor;
+};
+
+static constexpr TowerVisuals TOWER_VISUALS[] = {
+    { 22.0f, {200, 80, 80, 255},  {255, 150, 150, 255}, {255, 100, 100, 255} },   // Coral Cannon: coral red
+    { 25.0f, {60, 120, 200, 255}, {100, 180, 255, 255}, {100, 150, 255, 255} },   // Tidal Burst: ocean blue
+    { 20.0f, {150, 220, 255, 255}, {220, 245, 255, 255}, {200, 240, 255, 255} },  // Frost Totem: ice blue
+};
+
+static_assert(sizeof(TOWER_VISUALS) / sizeof(TOWER_VISUALS[0]) == TOWER_TYPE_COUNT,
+              "TOWER_VISUALS needs exactly one row per TowerType");
+
 Tower::Tower()
     : type(TowerType::CORAL_CANNON)
     , position{0, 0}
-    , fireCooldown(0.0f)
+    , level(0)
+    , targeting(TargetingMode::FIRST)
+    , target{}
+    , shotsAtTarget(0)
     , cooldownTime(1.0f)
     , selected(false)
     , radius(20.0f)
@@ -13,51 +33,33 @@ Tower::Tower()
 {
     stats = GetTowerStats(type);
     cooldownTime = 1.0f / stats.fireRate;
+    investedGold = stats.cost;
 }
 
 Tower::Tower(TowerType t, Vector2 pos)
     : type(t)
     , position(pos)
-    , fireCooldown(0.0f)
+    , level(0)
+    , targeting(TargetingMode::FIRST)
+    , target{}
+    , shotsAtTarget(0)
     , selected(false)
 {
     stats = GetTowerStats(type);
     cooldownTime = 1.0f / stats.fireRate;
+    investedGold = stats.cost;
     
     // Set visual properties based on type
-    switch (type) {
-        case TowerType::CORAL_CANNON:
-            radius = 22.0f;
-            baseColor = {200, 80, 80, 255};      // Coral red
-            accentColor = {255, 150, 150, 255};
-            break;
-            
-        case TowerType::TIDAL_BURST:
-            radius = 25.0f;
-            baseColor = {60, 120, 200, 255};     // Ocean blue
-            accentColor = {100, 180, 255, 255};
-            break;
-            
-        case TowerType::FROST_TOTEM:
-            radius = 20.0f;
-            baseColor = {150, 220, 255, 255};    // Ice blue
-            accentColor = {220, 245, 255, 255};
-            break;
-    }
-}
-
-void Tower::Update(float dt) {
-    // Reduce cooldown timer
-    if (fireCooldown > 0.0f) {
-        fireCooldown -= dt;
-        if (fireCooldown < 0.0f) {
-            fireCooldown = 0.0f;
-        }
-    }
+    const TowerVisuals& visuals = TOWER_VISUALS[static_cast<int>(type)];
+    radius = visuals.radius;
+    baseColor = visuals.baseColor;
+    accentColor = visuals.accentColor;
 }
 
 bool Tower::IsInRange(Vector2 enemyPos) const {
-    return GetDistanceTo(enemyPos) <= stats.range;
+    float dx = enemyPos.x - position.x;
+    float dy = enemyPos.y - position.y;
+    return dx * dx + dy * dy <= stats.range * stats.range;
 }
 
 float Tower::GetDistanceTo(Vector2 pos) const {
@@ -66,10 +68,6 @@ float Tower::GetDistanceTo(Vector2 pos) const {
     return std::sqrt(dx * dx + dy * dy);
 }
 
-bool Tower::CanFire() const {
-    return fireCooldown <= 0.0f;
-}
-
 Projectile Tower::Fire(Vector2 targetPos) {
     Projectile proj;
     proj.position = position;
@@ -82,25 +80,35 @@ Projectile Tower::Fire(Vector2 targetPos) {
     proj.active = true;
     
     // Set projectile color based on tower type
-    switch (type) {
-        case TowerType::CORAL_CANNON:
-            proj.color = {255, 100, 100, 255};
-            break;
-        case TowerType::TIDAL_BURST:
-            proj.color = {100, 150, 255, 255};
-            break;
-        case TowerType::FROST_TOTEM:
-            proj.color = {200, 240, 255, 255};
-            break;
-    }
+    proj.color = TOWER_VISUALS[static_cast<int>(type)].projectileColor;
     
-    // Reset cooldown
-    fireCooldown = cooldownTime;
+    shotsAtTarget++;
     
     return proj;
 }
 
-void Tower::Draw() const {
+int Tower::GetUpgradeCost() const {
+    if (!CanUpgrade()) return 0;
+    return GetTowerStats(type, level + 1).cost;
+}
+
+bool Tower::Upgrade() {
+    if (!CanUpgrade()) return false;
+    
+    level++;
+    stats = GetTowerStats(type, level);
+    investedGold += stats.cost;
+    
+    // A pending cooldown is capped to the new rate by TowerManager::OnTowerUpgraded
+    cooldownTime = 1.0f / stats.fireRate;
+    return true;
+}
+
+int Tower::GetSellValue() const {
+    return static_cast<int>(static_cast<float>(investedGold) * TOWER_SELL_REFUND);
+}
+
+void Tower::Draw(float cooldownLeft) const {
     // Draw base
     DrawCircleV(position, radius, baseColor);
     
@@ -135,6 +143,15 @@ void Tower::Draw() const {
                 2.0f, WHITE
             );
             break;
+            
+        default:
+            break;
+    }
+    
+    // Draw level pips below the tower
+    for (int i = 0; i < level; ++i) {
+        float pipX = position.x - (level - 1) * 5.0f + i * 10.0f;
+        DrawCircleV({pipX, position.y + radius + 6}, 3.0f, GOLD);
     }
     
     // Draw selection highlight
@@ -143,8 +160,8 @@ void Tower::Draw() const {
     }
     
     // Draw cooldown indicator
-    if (fireCooldown > 0.0f) {
-        float ratio = fireCooldown / cooldownTime;
+    if (cooldownLeft > 0.0f) {
+        float ratio = cooldownLeft / cooldownTime;
         DrawCircleSector(
             position, 
             radius * 0.4f, 
@@ -1,37 +1,90 @@
 #include "tower/TowerManager.h"
+#include "core/MemoryReport.h"
 #include <algorithm>
 #include <cmath>
 
-TowerManager::TowerManager()
-    : selectedTower(nullptr)
+TowerManager::TowerManager(Registry& registry)
+    : registry(registry)
+    , towers(registry.Pool<Tower>())
+    , projectiles(registry.Pool<Projectile>())
+    , selectedTower{}
+    , frameAllocator(std::pmr::get_default_resource())
+    , clock(0.0)
+    , previousClock(0.0)
+    , currentTick(0)
+    , impactWheel(IMPACT_WHEEL_SLOTS)
+    , processedTick(0)
+    , layoutVersion(0)
 {
+    towers.Reserve(INITIAL_TOWER_CAPACITY);
+    projectiles.Reserve(INITIAL_PROJECTILE_CAPACITY);
+    readyTowers.reserve(INITIAL_TOWER_CAPACITY);
+    cooldowns.Reserve(INITIAL_TOWER_CAPACITY);
+    idleTowers.Reserve(INITIAL_TOWER_CAPACITY);
 }
 
 void TowerManager::Update(float dt) {
-    // Update all towers
-    for (auto& tower : towers) {
-        tower.Update(dt);
-    }
+    previousClock = clock;
+    clock += dt;
+    currentTick = TimingWheel::TickAt(clock);
+    
+    // Only towers whose cooldown ran out this update are touched
+    cooldowns.Advance(currentTick, [this](Entity entity) {
+        readyTowers.push_back(entity);
+    });
+    idleTowers.Advance(currentTick, [this](Entity entity) {
+        readyTowers.push_back(entity);
+    });
     
     // Update projectiles
-    UpdateProjectiles(dt);
+    UpdateProjectiles();
+}
+
+void TowerManager::StartCooldown(Entity entity, const Tower& tower) {
+    // Same frame count as counting cooldownTime down by TICK each update
+    cooldowns.Schedule(entity, currentTick + std::max(TimingWheel::TicksFor(tower.GetCooldownTime()), 1u));
+}
+
+void TowerManager::OnTowerUpgraded(Tower* tower) {
+    layoutVersion++;
+    Entity entity = towers.EntityOf(tower);
+    if (!cooldowns.IsScheduled(entity)) return;
+    
+    uint32_t ticks = TimingWheel::TicksFor(tower->GetCooldownTime());
+    if (cooldowns.GetTick(entity) > currentTick + ticks) {
+        cooldowns.Schedule(entity, currentTick + std::max(ticks, 1u));
+    }
+}
+
+// True if pos (plus margin) overlaps view
+static bool InView(Vector2 pos, float margin, Rectangle view) {
+    return pos.x + margin >= view.x && pos.x - margin <= view.x + view.width
+        && pos.y + margin >= view.y && pos.y - margin <= view.y + view.height;
 }
 
-void TowerManager::Draw() const {
+void TowerManager::Draw(Rectangle view) const {
     // Draw tower ranges first (behind towers)
     DrawRanges();
     
-    // Draw all towers
-    for (const auto& tower : towers) {
-        tower.Draw();
+    // Draw the towers in view (with the cooldown left until their ready tick)
+    const std::vector<Tower>& list = towers.Components();
+    for (size_t i = 0; i < list.size(); ++i) {
+        if (!InView(list[i].GetPosition(), TOWER_DRAW_MARGIN, view)) continue;
+        
+        float cooldownLeft = 0.0f;
+        Entity entity = towers.Entities()[i];
+        if (cooldowns.IsScheduled(entity)) {
+            cooldownLeft = static_cast<float>(cooldowns.GetTick(entity) * static_cast<double>(TimingWheel::TICK) - clock);
+        }
+        list[i].Draw(cooldownLeft);
     }
     
     // Draw projectiles on top
-    DrawProjectiles();
+    DrawProjectiles(view);
 }
 
 void TowerManager::DrawRanges() const {
-    for (const auto& tower : towers) {
+    for (const auto& tower : towers.Components()) {
         if (tower.IsSelected()) {
             tower.DrawRange();
         }
@@ -39,9 +92,20 @@ void TowerManager::DrawRanges() const {
 }
 
 void TowerManager::Clear() {
-    towers.clear();
-    projectiles.clear();
-    selectedTower = nullptr;
+    registry.DestroyAll<Tower>();
+    registry.DestroyAll<Projectile>();
+    selectedTower = Entity{};
+    
+    cooldowns.Clear();
+    idleTowers.Clear();
+    readyTowers.clear();
+    
+    std::fill(impactWheel.begin(), impactWheel.end(), Entity{});
+    clock = 0.0;
+    previousClock = 0.0;
+    currentTick = 0;
+    processedTick = 0;
+    layoutVersion++;
 }
 
 bool TowerManager::PlaceTower(TowerType type, Vector2 position) {
@@ -50,21 +114,34 @@ bool TowerManager::PlaceTower(TowerType type, Vector2 position) {
         return false;
     }
     
-    towers.emplace_back(type, position);
+    Entity entity = registry.Create();
+    registry.Emplace<Tower>(entity, type, position);
+    
+    // Built towers are ready to fire at once
+    cooldowns.Reserve(static_cast<size_t>(entity.index) + 1);
+    idleTowers.Reserve(static_cast<size_t>(entity.index) + 1);
+    readyTowers.push_back(entity);
+    layoutVersion++;
     return true;
 }
 
 bool TowerManager::RemoveTower(Vector2 position) {
-    for (auto it = towers.begin(); it != towers.end(); ++it) {
-        float dx = it->GetPosition().x - position.x;
-        float dy = it->GetPosition().y - position.y;
+    const std::vector<Tower>& list = towers.Components();
+    for (size_t i = 0; i < list.size(); ++i) {
+        float dx = list[i].GetPosition().x - position.x;
+        float dy = list[i].GetPosition().y - position.y;
         float dist = std::sqrt(dx * dx + dy * dy);
         
         if (dist < 30.0f) {
-            if (selectedTower == &(*it)) {
-                selectedTower = nullptr;
+            Entity entity = towers.Entities()[i];
+            if (selectedTower == entity) {
+                selectedTower = Entity{};
             }
-            towers.erase(it);
+            cooldowns.Cancel(entity);
+            idleTowers.Cancel(entity);
+            readyTowers.erase(std::remove(readyTowers.begin(), readyTowers.end(), entity), readyTowers.end());
+            registry.Destroy(entity);
+            layoutVersion++;
             return true;
         }
     }
@@ -72,7 +149,7 @@ bool TowerManager::RemoveTower(Vector2 position) {
 }
 
 Tower* TowerManager::GetTowerAt(Vector2 position, float tolerance) {
-    for (auto& tower : towers) {
+    for (auto& tower : towers.Components()) {
         float dx = tower.GetPosition().x - position.x;
         float dy = tower.GetPosition().y - position.y;
         float dist = std::sqrt(dx * dx + dy * dy);
@@ -88,79 +165,126 @@ void TowerManager::SelectTower(Tower* tower) {
     DeselectAll();
     if (tower) {
         tower->SetSelected(true);
-        selectedTower = tower;
+        selectedTower = towers.EntityOf(tower);
     }
 }
 
 void TowerManager::DeselectAll() {
-    for (auto& tower : towers) {
+    for (auto& tower : towers.Components()) {
         tower.SetSelected(false);
     }
-    selectedTower = nullptr;
+    selectedTower = Entity{};
 }
 
 void TowerManager::AddProjectile(const Projectile& proj) {
-    projectiles.push_back(proj);
+    Entity entity = registry.Create();
+    Projectile& added = registry.Emplace<Projectile>(entity, proj);
+    ScheduleImpact(entity, added);
 }
 
-void TowerManager::UpdateProjectiles(float dt) {
-    for (auto& proj : projectiles) {
-        if (!proj.active) continue;
-        
-        // Calculate direction to target
-        float dx = proj.targetPos.x - proj.position.x;
-        float dy = proj.targetPos.y - proj.position.y;
-        float dist = std::sqrt(dx * dx + dy * dy);
+void TowerManager::ScheduleImpact(Entity entity, Projectile& proj) {
+    float dx = proj.targetPos.x - proj.position.x;
+    float dy = proj.targetPos.y - proj.position.y;
+    float dist = std::sqrt(dx * dx + dy * dy);
+    float invDist = 1.0f / (dist + 0.0001f);
+    
+    // The hit lands once the projectile is within PROJECTILE_HIT_RADIUS of its target
+    proj.velocity = { dx * invDist * proj.speed, dy * invDist * proj.speed };
+    proj.flightTime = std::max(dist - PROJECTILE_HIT_RADIUS, 0.0f) / proj.speed;
+    proj.launchTime = clock;
+    
+    double impactTime = clock + proj.flightTime;
+    uint32_t tick = static_cast<uint32_t>(std::ceil(impactTime / TimingWheel::TICK));
+    proj.impactTick = std::max(tick, processedTick + 1);
+    
+    Entity& head = impactWheel[proj.impactTick & (IMPACT_WHEEL_SLOTS - 1)];
+    proj.nextImpact = head;
+    head = entity;
+}
+
+void TowerManager::UpdateProjectiles() {
+    if (currentTick <= processedTick) return;
+    
+    // Hits are resolved after the wheel pass; the list lives in tick-scoped memory
+    struct PendingHit {
+        Projectile proj;
+        Vector2 sweepStart;
+        Vector2 position;
+    };
+    std::pmr::vector<PendingHit> hits(frameAllocator);
+    
+    // Visit each slot of the ticks that passed (at most one full turn)
+    uint32_t ticks = std::min(currentTick - processedTick, IMPACT_WHEEL_SLOTS);
+    for (uint32_t t = 1; t <= ticks; ++t) {
+        Entity& head = impactWheel[(processedTick + t) & (IMPACT_WHEEL_SLOTS - 1)];
+        Entity entity = head;
+        head = Entity{};
         
-        // Check if reached target
-        if (dist < PROJECTILE_HIT_RADIUS) {
-            proj.active = false;
-            
-            // Trigger hit callback
-            if (onProjectileHit) {
-                onProjectileHit(proj, proj.targetPos);
+        while (Projectile* proj = projectiles.TryGet(entity)) {
+            Entity next = proj->nextImpact;
+            if (proj->impactTick <= currentTick) {
+                // Where the projectile was when this update began
+                float elapsed = std::clamp(static_cast<float>(previousClock - proj->launchTime), 0.0f, proj->flightTime);
+                Vector2 sweepStart = { proj->position.x + proj->velocity.x * elapsed,
+                                       proj->position.y + proj->velocity.y * elapsed };
+                hits.push_back({ *proj, sweepStart, proj->targetPos });
+                registry.Destroy(entity);
+            } else {
+                // Due on a later turn of the wheel
+                proj->nextImpact = head;
+                head = entity;
             }
-            continue;
+            entity = next;
         }
-        
-        // Normalize and move
-        float invDist = 1.0f / (dist + 0.0001f);
-        proj.position.x += dx * invDist * proj.speed * dt;
-        proj.position.y += dy * invDist * proj.speed * dt;
     }
+    processedTick = currentTick;
     
-    // Remove inactive projectiles
-    projectiles.erase(
-        std::remove_if(projectiles.begin(), projectiles.end(),
-            [](const Projectile& p) { return !p.active; }),
-        projectiles.end()
-    );
+    // Trigger hit callbacks
+    if (onProjectileHit) {
+        for (PendingHit& hit : hits) {
+            onProjectileHit(hit.proj, hit.sweepStart, hit.position);
+        }
+    }
+}
+
+Vector2 TowerManager::GetProjectilePosition(const Projectile& proj) const {
+    float elapsed = static_cast<float>(clock - proj.launchTime);
+    elapsed = std::clamp(elapsed, 0.0f, proj.flightTime);
+    return { proj.position.x + proj.velocity.x * elapsed,
+             proj.position.y + proj.velocity.y * elapsed };
 }
 
-void TowerManager::DrawProjectiles() const {
-    for (const auto& proj : projectiles) {
+void TowerManager::DrawProjectiles(Rectangle view) const {
+    for (const auto& proj : projectiles.Components()) {
         if (!proj.active) continue;
         
+        Vector2 position = GetProjectilePosition(proj);
+        if (!InView(position, PROJECTILE_DRAW_MARGIN, view)) continue;
+        
         // Draw projectile
-        DrawCircleV(proj.position, 5.0f, proj.color);
+        DrawCircleV(position, 5.0f, proj.color);
         
         // Draw trail
         DrawLineEx(
-            proj.position,
-            {proj.position.x - (proj.targetPos.x - proj.position.x) * 0.1f,
-             proj.position.y - (proj.targetPos.y - proj.position.y) * 0.1f},
+            position,
+            {position.x - (proj.targetPos.x - position.x) * 0.1f,
+             position.y - (proj.targetPos.y - position.y) * 0.1f},
             3.0f,
             {proj.color.r, proj.color.g, proj.color.b, 128}
         );
     }
 }
 
-void TowerManager::SetOnProjectileHit(std::function<void(Projectile&, Vector2)> callback) {
+void TowerManager::SetOnProjectileHit(std::function<void(Projectile&, Vector2, Vector2)> callback) {
     onProjectileHit = std::move(callback);
 }
 
+void TowerManager::SetFrameAllocator(std::pmr::memory_resource* resource) {
+    frameAllocator = resource ? resource : std::pmr::get_default_resource();
+}
+
 bool TowerManager::HasTowerAt(Vector2 position, float tolerance) const {
-    for (const auto& tower : towers) {
+    for (const auto& tower : towers.Components()) {
         float dx = tower.GetPosition().x - position.x;
         float dy = tower.GetPosition().y - position.y;
         float dist = std::sqrt(dx * dx + dy * dy);
@@ -171,3 +295,10 @@ bool TowerManager::HasTowerAt(Vector2 position, float tolerance) const {
     }
     return false;
 }
+
+void TowerManager::ReportMemory(MemoryReport& report) const {
+    report.Add("Towers", sizeof(Tower), towers.Size(), towers.Capacity(),
+        towers.MemoryBytes() + cooldowns.MemoryBytes() + idleTowers.MemoryBytes() + MemoryReport::VectorBytes(readyTowers));
+    report.Add("Projectiles", sizeof(Projectile), projectiles.Size(), projectiles.Capacity(),
+        projectiles.MemoryBytes() + MemoryReport::VectorBytes(impactWheel));
+}
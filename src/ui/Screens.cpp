@@ -29,7 +29,8 @@ void DrawStart(const Font& font) {
     DrawCenteredText(font, "Guardians of the Deep", titleSize, spacing, GetScreenHeight() * 0.28f, { 140, 220, 255, 255 });
     DrawCenteredText(font, "Derinliklerden gelen karanlik, Aqualis'i tehdit ediyor...", bodySize, spacing, GetScreenHeight() * 0.45f, { 220, 235, 255, 255 });
     DrawCenteredText(font, "ENTER ile savunmaya basla", bodySize, spacing, GetScreenHeight() * 0.60f, { 255, 255, 255, 255 });
-    DrawCenteredText(font, "ESC ile cik", bodySize, spacing, GetScreenHeight() * 0.68f, { 200, 220, 240, 255 });
+    DrawCenteredText(font, "E ile sonsuz mod", bodySize, spacing, GetScreenHeight() * 0.68f, { 200, 220, 240, 255 });
+    DrawCenteredText(font, "ESC ile cik", bodySize, spacing, GetScreenHeight() * 0.76f, { 200, 220, 240, 255 });
 }
 
 void DrawPaused(const Font& font) {
@@ -1,4 +1,145 @@
 #include "utils/Math.h"
+#include "utils/Simd.h"
 
-// Most math utilities are inline in the header
-// This file exists for any non-inline implementations needed in the future
+#include <algorithm>
+
+// Most math utilities are inline in the header; the batch kernels and
+// the spline evaluation live here
+
+namespace MathUtils {
+
+bool CpuHasAVX2()
+{
+#if defined(GOTD_SIMD_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    // OS must save YMM state (OSXSAVE + XCR0 bits 1 and 2)
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif defined(GOTD_SIMD_X86)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+// Scalar tail shared by all paths
+static size_t PointsInRadiusScalar(float cx, float cy, float radiusSq,
+                                   const float* xs, const float* ys, size_t begin, size_t count,
+                                   int* out, size_t written)
+{
+    for (size_t i = begin; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        out[written] = static_cast<int>(i);
+        written += (dx * dx + dy * dy <= radiusSq) ? 1 : 0;
+    }
+    return written;
+}
+
+#if defined(GOTD_SIMD_X86)
+
+// 8 points per step; hits are appended branch-free from the compare mask
+GOTD_TARGET_AVX2
+static size_t PointsInRadiusAVX2(float cx, float cy, float radiusSq,
+                                 const float* xs, const float* ys, size_t count, int* out)
+{
+    const __m256 cxVec = _mm256_set1_ps(cx);
+    const __m256 cyVec = _mm256_set1_ps(cy);
+    const __m256 rVec = _mm256_set1_ps(radiusSq);
+
+    size_t written = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cxVec);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cyVec);
+        __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(distSq, rVec, _CMP_LE_OQ));
+        if (mask == 0) continue;
+
+        for (int lane = 0; lane < 8; ++lane) {
+            out[written] = static_cast<int>(i) + lane;
+            written += (mask >> lane) & 1;
+        }
+    }
+    return PointsInRadiusScalar(cx, cy, radiusSq, xs, ys, i, count, out, written);
+}
+
+static size_t PointsInRadiusSSE2(float cx, float cy, float radiusSq,
+                                 const float* xs, const float* ys, size_t count, int* out)
+{
+    const __m128 cxVec = _mm_set1_ps(cx);
+    const __m128 cyVec = _mm_set1_ps(cy);
+    const __m128 rVec = _mm_set1_ps(radiusSq);
+
+    size_t written = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cxVec);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cyVec);
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        int mask = _mm_movemask_ps(_mm_cmple_ps(distSq, rVec));
+        if (mask == 0) continue;
+
+        for (int lane = 0; lane < 4; ++lane) {
+            out[written] = static_cast<int>(i) + lane;
+            written += (mask >> lane) & 1;
+        }
+    }
+    return PointsInRadiusScalar(cx, cy, radiusSq, xs, ys, i, count, out, written);
+}
+
+#endif
+
+size_t PointsInRadius(Vector2 center, float radius,
+                      const float* xs, const float* ys, size_t count, int* outIndices)
+{
+    float radiusSq = radius * radius;
+#if defined(GOTD_SIMD_X86)
+    static const bool useAVX2 = CpuHasAVX2();
+    if (useAVX2) {
+        return PointsInRadiusAVX2(center.x, center.y, radiusSq, xs, ys, count, outIndices);
+    }
+    return PointsInRadiusSSE2(center.x, center.y, radiusSq, xs, ys, count, outIndices);
+#else
+    return PointsInRadiusScalar(center.x, center.y, radiusSq, xs, ys, 0, count, outIndices, 0);
+#endif
+}
+
+// ============================================================
+// Centripetal Catmull-Rom (Barry-Goldman pyramid, alpha = 0.5)
+// ============================================================
+static float KnotStep(Vector2 a, Vector2 b)
+{
+    // sqrt of the chord length; floored so repeated points don't divide by zero
+    return std::max(std::sqrt(Distance(a, b)), 1e-3f);
+}
+
+static Vector2 Blend(Vector2 a, Vector2 b, float ta, float tb, float t)
+{
+    return Lerp(a, b, (t - ta) / (tb - ta));
+}
+
+Vector2 CatmullRom(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, float t)
+{
+    float t0 = 0.0f;
+    float t1 = t0 + KnotStep(p0, p1);
+    float t2 = t1 + KnotStep(p1, p2);
+    float t3 = t2 + KnotStep(p2, p3);
+    float u = Lerp(t1, t2, t);
+
+    Vector2 a1 = Blend(p0, p1, t0, t1, u);
+    Vector2 a2 = Blend(p1, p2, t1, t2, u);
+    Vector2 a3 = Blend(p2, p3, t2, t3, u);
+    Vector2 b1 = Blend(a1, a2, t0, t2, u);
+    Vector2 b2 = Blend(a2, a3, t1, t3, u);
+    return Blend(b1, b2, t1, t2, u);
+}
+
+} // namespace MathUtils
@@ -0,0 +1,157 @@
+#include "utils/SpatialGrid.h"
+#include "utils/Math.h"
+
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : baseCellSize(cellSize)
+    , cellSize(cellSize)
+    , invCellSize(1.0f / cellSize)
+    , originX(0.0f)
+    , originY(0.0f)
+    , cols(0)
+    , rows(0)
+    , pointX(nullptr)
+    , pointY(nullptr)
+{
+    cellStart.reserve(MAX_CELLS_PER_AXIS * MAX_CELLS_PER_AXIS + 1);
+}
+
+void SpatialGrid::Reserve(size_t points)
+{
+    cellPoints.reserve(points);
+    cellX.reserve(points);
+    cellY.reserve(points);
+    pointCell.reserve(points);
+    rowHits.reserve(points);
+}
+
+size_t SpatialGrid::MemoryBytes() const
+{
+    return (cellStart.capacity() + cellPoints.capacity() + pointCell.capacity() + rowHits.capacity()) * sizeof(int)
+        + (cellX.capacity() + cellY.capacity()) * sizeof(float);
+}
+
+int SpatialGrid::CellX(float x) const
+{
+    int cx = static_cast<int>(std::floor((x - originX) * invCellSize));
+    return std::clamp(cx, 0, cols - 1);
+}
+
+int SpatialGrid::CellY(float y) const
+{
+    int cy = static_cast<int>(std::floor((y - originY) * invCellSize));
+    return std::clamp(cy, 0, rows - 1);
+}
+
+void SpatialGrid::Build(const float* xs, const float* ys, size_t count)
+{
+    pointX = xs;
+    pointY = ys;
+    cellPoints.resize(count);
+    cellX.resize(count);
+    cellY.resize(count);
+    pointCell.resize(count);
+    rowHits.resize(count);
+    
+    if (count == 0) {
+        cols = 0;
+        rows = 0;
+        cellStart.assign(1, 0);
+        return;
+    }
+    
+    // Bounding box of the points
+    float minX = xs[0], maxX = xs[0];
+    float minY = ys[0], maxY = ys[0];
+    for (size_t i = 1; i < count; ++i) {
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+    originX = minX;
+    originY = minY;
+    
+    // Spread over at most MAX_CELLS_PER_AXIS cells per side
+    float span = std::max(maxX - minX, maxY - minY);
+    cellSize = std::max(baseCellSize, span / static_cast<float>(MAX_CELLS_PER_AXIS - 1));
+    invCellSize = 1.0f / cellSize;
+    cols = std::clamp(static_cast<int>((maxX - minX) * invCellSize) + 1, 1, MAX_CELLS_PER_AXIS);
+    rows = std::clamp(static_cast<int>((maxY - minY) * invCellSize) + 1, 1, MAX_CELLS_PER_AXIS);
+    
+    // Counting sort: count per cell, prefix sum, then scatter
+    cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        int cell = CellY(ys[i]) * cols + CellX(xs[i]);
+        pointCell[i] = cell;
+        cellStart[cell + 1]++;
+    }
+    for (size_t c = 1; c < cellStart.size(); ++c) {
+        cellStart[c] += cellStart[c - 1];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        cellPoints[--cellStart[pointCell[i] + 1]] = static_cast<int>(i);
+    }
+    // Scatter left each cellStart[c + 1] at the start of cell c; shift back into place
+    for (size_t c = 0; c + 1 < cellStart.size(); ++c) {
+        cellStart[c] = cellStart[c + 1];
+    }
+    cellStart.back() = static_cast<int>(count);
+    
+    for (size_t k = 0; k < count; ++k) {
+        cellX[k] = xs[cellPoints[k]];
+        cellY[k] = ys[cellPoints[k]];
+    }
+}
+
+size_t SpatialGrid::QuerySegment(Vector2 a, Vector2 b, float radius, int* outIndices) const
+{
+    if (cols == 0) return 0;
+    
+    // Cells overlapping the segment's bounding box grown by radius
+    int x0 = CellX(std::min(a.x, b.x) - radius);
+    int x1 = CellX(std::max(a.x, b.x) + radius);
+    int y0 = CellY(std::min(a.y, b.y) - radius);
+    int y1 = CellY(std::max(a.y, b.y) + radius);
+    float radiusSq = radius * radius;
+    
+    size_t found = 0;
+    for (int cy = y0; cy <= y1; ++cy) {
+        for (int cx = x0; cx <= x1; ++cx) {
+            int cell = cy * cols + cx;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                int i = cellPoints[k];
+                if (MathUtils::SegmentDistanceSquared({ pointX[i], pointY[i] }, a, b) <= radiusSq) {
+                    outIndices[found++] = i;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+size_t SpatialGrid::QueryRadius(Vector2 center, float radius, int* outIndices, size_t maxResults) const
+{
+    if (cols == 0 || maxResults == 0) return 0;
+    
+    int x0 = CellX(center.x - radius);
+    int x1 = CellX(center.x + radius);
+    int y0 = CellY(center.y - radius);
+    int y1 = CellY(center.y + radius);
+    
+    // Cells x0..x1 of a row are one contiguous span of the cell-ordered coordinates
+    size_t found = 0;
+    for (int cy = y0; cy <= y1; ++cy) {
+        int begin = cellStart[cy * cols + x0];
+        int end = cellStart[cy * cols + x1 + 1];
+        size_t hits = MathUtils::PointsInRadius(center, radius, cellX.data() + begin, cellY.data() + begin,
+                                                static_cast<size_t>(end - begin), rowHits.data());
+        for (size_t h = 0; h < hits; ++h) {
+            outIndices[found++] = cellPoints[begin + rowHits[h]];
+            if (found == maxResults) return found;
+        }
+    }
+    return found;
+}
@@ -4,11 +4,12 @@
 // ============================================================
 // Constructor
 // ============================================================
-EconomySystem::EconomySystem()
+EconomySystem::EconomySystem(EventBus& events)
     : gold(0)
     , totalEarned(0)
     , totalSpent(0)
     , startingAmount(0)
+    , events(events)
 {
 }
 
@@ -23,9 +24,7 @@ void EconomySystem::Init(int startingGold)
     totalSpent = 0;
     
     // Notify listeners of initial gold
-    if (onGoldChanged) {
-        onGoldChanged(gold);
-    }
+    events.Publish(GoldChanged{ gold });
 }
 
 void EconomySystem::Reset()
@@ -34,9 +33,7 @@ void EconomySystem::Reset()
     totalEarned = startingAmount;
     totalSpent = 0;
     
-    if (onGoldChanged) {
-        onGoldChanged(gold);
-    }
+    events.Publish(GoldChanged{ gold });
 }
 
 // ============================================================
@@ -51,9 +48,7 @@ void EconomySystem::AddGold(int amount)
     gold += amount;
     totalEarned += amount;
     
-    if (onGoldChanged) {
-        onGoldChanged(gold);
-    }
+    events.Publish(GoldChanged{ gold });
 }
 
 bool EconomySystem::SpendGold(int amount)
@@ -64,18 +59,14 @@ bool EconomySystem::SpendGold(int amount)
     
     if (!CanAfford(amount)) {
         // Notify about insufficient funds
-        if (onInsufficientFunds) {
-            onInsufficientFunds(amount, gold);
-        }
+        events.Publish(InsufficientFunds{ amount, gold });
         return false;
     }
     
     gold -= amount;
     totalSpent += amount;
     
-    if (onGoldChanged) {
-        onGoldChanged(gold);
-    }
+    events.Publish(GoldChanged{ gold });
     
     return true;
 }
@@ -85,19 +76,6 @@ bool EconomySystem::CanAfford(int cost) const
     return gold >= cost;
 }
 
-// ============================================================
-// Callbacks
-// ============================================================
-void EconomySystem::SetOnGoldChanged(std::function<void(int)> callback)
-{
-    onGoldChanged = std::move(callback);
-}
-
-void EconomySystem::SetOnInsufficientFunds(std::function<void(int, int)> callback)
-{
-    onInsufficientFunds = std::move(callback);
-}
-
 // ============================================================
 // Bonuses
 // ============================================================
@@ -1,12 +1,14 @@
 #include "wave/WaveManager.h"
-#include <cstdlib>  // for rand()
+#include "core/MemoryReport.h"
 #include <algorithm>
+#include <cmath>
 
 // ============================================================
 // Constructor
 // ============================================================
-WaveManager::WaveManager()
-    : currentWave(0)
+WaveManager::WaveManager(EventBus& events)
+    : economy(events)
+    , currentWave(0)
     , totalWaves(10)
     , waveState(WaveState::WAITING)
     , spawnPoint{0.0f, 0.0f}
@@ -17,6 +19,8 @@ WaveManager::WaveManager()
     , waveStartTimer(0.0f)
     , bossWarningTimer(0.0f)
     , autoStartWaves(false)
+    , endlessMode(false)
+    , events(events)
 {
     InitializeWaveConfigs();
 }
@@ -40,6 +44,9 @@ void WaveManager::Reset()
     enemiesSpawnedThisWave = 0;
     waveStartTimer = DEFAULT_WAVE_DELAY;
     bossWarningTimer = 0.0f;
+    waveHistory.clear();
+    waveHistory.reserve(std::max(totalWaves, HISTORY_RESERVE));
+    activeWave = WaveData();
     
     economy.Reset();
     economy.Init(STARTING_GOLD);
@@ -91,8 +98,35 @@ void WaveManager::InitializeWaveConfigs()
     totalWaves = static_cast<int>(waveConfigs.size());
 }
 
+WaveData WaveManager::GenerateEndlessWave(int waveIndex)
+{
+    int n = std::max(waveIndex, 0);
+    int waveNumber = n + 1;
+    
+    // Count grows geometrically so late waves reach tens of thousands
+    int count = static_cast<int>(5.0f * std::pow(ENDLESS_COUNT_GROWTH, static_cast<float>(n))) + n;
+    
+    // Spread each wave over a fixed window; at high counts several enemies spawn per frame
+    float interval = std::clamp(ENDLESS_SPAWN_WINDOW / static_cast<float>(count), ENDLESS_MIN_INTERVAL, 2.0f);
+    
+    // Rotate compositions: primary cycles NORMAL -> FAST -> TANK, secondary is the next type
+    static constexpr EnemyType rotation[] = { EnemyType::NORMAL, EnemyType::FAST, EnemyType::TANK };
+    EnemyType primary = rotation[n % 3];
+    EnemyType secondary = rotation[(n + 1 + n / 3) % 3];
+    float secondaryRatio = std::min(0.5f, 0.1f + 0.02f * static_cast<float>(n));
+    
+    bool boss = (waveNumber % ENDLESS_BOSS_EVERY) == 0;
+    float hpMultiplier = 1.0f + ENDLESS_HP_GROWTH * static_cast<float>(n);
+    
+    return WaveData(count, interval, primary, secondary, secondaryRatio, boss, hpMultiplier);
+}
+
 WaveData WaveManager::GetWaveConfig(int waveIndex) const
 {
+    if (endlessMode) {
+        return GenerateEndlessWave(waveIndex);
+    }
+    
     if (waveIndex < 0 || waveIndex >= static_cast<int>(waveConfigs.size())) {
         // Return default safe wave
         return WaveData();
@@ -103,7 +137,8 @@ WaveData WaveManager::GetWaveConfig(int waveIndex) const
 EnemyType WaveManager::DetermineEnemyType(const WaveData& wave)
 {
     // Use random ratio to determine enemy type
-    float roll = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    float roll = dist(rng);
     
     if (roll < wave.secondaryRatio) {
         return wave.secondaryType;
@@ -118,8 +153,8 @@ void WaveManager::Update(float dt)
 {
     switch (waveState) {
         case WaveState::WAITING:
-            // Auto-start countdown (optional)
-            if (autoStartWaves && currentWave < totalWaves) {
+            // Auto-start countdown (optional, always on in endless mode)
+            if ((autoStartWaves || endlessMode) && (endlessMode || currentWave < totalWaves)) {
                 waveStartTimer -= dt;
                 if (waveStartTimer <= 0.0f) {
                     StartNextWave();
@@ -134,8 +169,7 @@ void WaveManager::Update(float dt)
                 // Transition to spawning
                 waveState = WaveState::SPAWNING;
                 
-                WaveData config = GetWaveConfig(currentWave - 1);
-                enemiesRemainingToSpawn = config.enemyCount;
+                enemiesRemainingToSpawn = activeWave.enemyCount;
                 spawnTimer = 0.0f; // Start spawning immediately
                 enemiesSpawnedThisWave = 0;
             }
@@ -146,26 +180,32 @@ void WaveManager::Update(float dt)
             spawnTimer -= dt;
             
             if (spawnTimer <= 0.0f && enemiesRemainingToSpawn > 0) {
-                // Spawn an enemy
-                WaveData config = GetWaveConfig(currentWave - 1);
-                EnemyType typeToSpawn = DetermineEnemyType(config);
+                const WaveData& config = activeWave;
                 
-                // For boss wave, spawn boss (Abyss Lord) as last enemy
-                if (config.isBossWave && enemiesRemainingToSpawn == 1) {
-                    typeToSpawn = EnemyType::BOSS; // Abyss Lord
-                }
-                
-                // Trigger spawn callback
-                if (onSpawnEnemy) {
-                    onSpawnEnemy(typeToSpawn, spawnPoint);
+                // Short intervals (endless mode) may spawn several enemies per frame
+                while (spawnTimer <= 0.0f && enemiesRemainingToSpawn > 0) {
+                    EnemyType typeToSpawn = DetermineEnemyType(config);
+                    
+                    // For boss wave, spawn boss (Abyss Lord) as last enemy
+                    if (config.isBossWave && enemiesRemainingToSpawn == 1) {
+                        typeToSpawn = EnemyType::BOSS; // Abyss Lord
+                    }
+                    
+                    // Spawned by whoever handles the event at the end of the tick
+                    events.Publish(EnemySpawnRequested{ typeToSpawn, spawnPoint, config.hpMultiplier });
+                    
+                    enemiesRemainingToSpawn--;
+                    enemiesSpawnedThisWave++;
+                    activeEnemyCount++;
+                    
+                    // Schedule next spawn, keeping the overshoot
+                    spawnTimer += config.spawnInterval;
                 }
-                
-                enemiesRemainingToSpawn--;
-                enemiesSpawnedThisWave++;
-                activeEnemyCount++;
-                
-                // Reset spawn timer
-                spawnTimer = config.spawnInterval;
+            }
+            
+            if (!waveHistory.empty()) {
+                waveHistory.back().peakActiveEnemies =
+                    std::max(waveHistory.back().peakActiveEnemies, activeEnemyCount);
             }
             
             // Check if all enemies spawned
@@ -178,16 +218,12 @@ void WaveManager::Update(float dt)
             // Waiting for all enemies to be killed
             if (activeEnemyCount <= 0) {
                 // Wave cleared!
-                if (onWaveCleared) {
-                    onWaveCleared();
-                }
+                events.Publish(WaveCleared{ currentWave });
                 
-                // Check for victory
-                if (currentWave >= totalWaves) {
+                // Check for victory (endless mode never completes)
+                if (!endlessMode && currentWave >= totalWaves) {
                     waveState = WaveState::COMPLETED;
-                    if (onAllWavesCompleted) {
-                        onAllWavesCompleted();
-                    }
+                    events.Publish(AllWavesCompleted{ currentWave });
                 } else {
                     // Prepare for next wave
                     waveState = WaveState::WAITING;
@@ -213,16 +249,21 @@ void WaveManager::StartNextWave()
     
     currentWave++;
     
-    WaveData config = GetWaveConfig(currentWave - 1);
+    activeWave = GetWaveConfig(currentWave - 1);
+    const WaveData& config = activeWave;
+    
+    WaveRecord record;
+    record.wave = currentWave;
+    record.enemyCount = config.enemyCount;
+    record.hpMultiplier = config.hpMultiplier;
+    waveHistory.push_back(record);
     
     // Check for boss wave - show warning first
     if (config.isBossWave) {
         waveState = WaveState::BOSS_WARNING;
         bossWarningTimer = BOSS_WARNING_DURATION;
         
-        if (onBossWarning) {
-            onBossWarning();
-        }
+        events.Publish(BossWarning{ currentWave });
     } else {
         // Normal wave - start spawning immediately
         waveState = WaveState::SPAWNING;
@@ -239,13 +280,36 @@ bool WaveManager::CanStartNextWave() const
     // 2. Haven't reached total waves
     // 3. No active enemies (wave must be cleared)
     return waveState == WaveState::WAITING && 
-           currentWave < totalWaves && 
+           (endlessMode || currentWave < totalWaves) && 
            activeEnemyCount <= 0;
 }
 
+// ============================================================
+// Endless Mode & Statistics
+// ============================================================
+float WaveManager::GetCurrentHpMultiplier() const
+{
+    if (currentWave <= 0) {
+        return 1.0f;
+    }
+    return activeWave.hpMultiplier;
+}
+
+void WaveManager::RecordFrameCost(double simSeconds, double drawSeconds)
+{
+    if (waveHistory.empty()) {
+        return;
+    }
+    
+    WaveRecord& record = waveHistory.back();
+    record.frames++;
+    record.simSeconds += simSeconds;
+    record.drawSeconds += drawSeconds;
+}
+
 void WaveManager::ForceStartWave(int waveIndex)
 {
-    if (waveIndex < 1 || waveIndex > totalWaves) {
+    if (waveIndex < 1 || (!endlessMode && waveIndex > totalWaves)) {
         return;
     }
     
@@ -265,46 +329,22 @@ void WaveManager::SetSpawnPoint(Vector2 point)
     spawnPoint = point;
 }
 
-void WaveManager::SetOnSpawnEnemy(std::function<void(EnemyType, Vector2)> callback)
-{
-    onSpawnEnemy = std::move(callback);
-}
-
-void WaveManager::SetOnWaveCleared(std::function<void()> callback)
-{
-    onWaveCleared = std::move(callback);
-}
-
-void WaveManager::SetOnAllWavesCompleted(std::function<void()> callback)
-{
-    onAllWavesCompleted = std::move(callback);
-}
-
-void WaveManager::SetOnBossWarning(std::function<void()> callback)
-{
-    onBossWarning = std::move(callback);
-}
-
 // ============================================================
 // Enemy Event Handlers
 // ============================================================
-void WaveManager::OnEnemyKilled(int reward)
+void WaveManager::OnEnemiesKilled(int count, int totalReward)
 {
-    // Award gold for killing enemy
-    economy.AddGold(reward);
+    // Award gold for the whole batch at once
+    economy.AddGold(totalReward);
     
     // Decrement active count
-    if (activeEnemyCount > 0) {
-        activeEnemyCount--;
-    }
+    activeEnemyCount = std::max(0, activeEnemyCount - count);
 }
 
-void WaveManager::OnEnemyReachedBase()
+void WaveManager::OnEnemiesReachedBase(int count)
 {
-    // Enemy reached base - decrement counter (handled by game for HP)
-    if (activeEnemyCount > 0) {
-        activeEnemyCount--;
-    }
+    // Enemies reached base - decrement counter (handled by game for HP)
+    activeEnemyCount = std::max(0, activeEnemyCount - count);
 }
 
 void WaveManager::OnEnemyRemoved()
@@ -314,3 +354,13 @@ void WaveManager::OnEnemyRemoved()
         activeEnemyCount--;
     }
 }
+
+// ============================================================
+// Memory
+// ============================================================
+void WaveManager::ReportMemory(MemoryReport& report) const
+{
+    report.Add("Wave data", sizeof(WaveRecord), waveHistory.size(), waveHistory.capacity(),
+        MemoryReport::VectorBytes(waveConfigs) + MemoryReport::VectorBytes(waveHistory));
+    report.Add("Spawn queue", 0, static_cast<size_t>(std::max(enemiesRemainingToSpawn, 0)), 0, 0);
+}